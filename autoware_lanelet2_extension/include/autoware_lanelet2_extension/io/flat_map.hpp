@@ -0,0 +1,360 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__IO__FLAT_MAP_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__IO__FLAT_MAP_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/BoundingBox.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lanelet::io_handlers
+{
+/**
+ * Read-only flat map format.
+ *
+ * The file is a Header followed by fixed-size record arrays (sections). Records refer to each other
+ * by index, never by pointer, so a file can be mmap'ed and read in place by any number of
+ * processes. Primitive records are sorted by id, which allows binary search lookups.
+ * All integers are stored in host byte order; the endianness marker rejects files written on a
+ * host of the other byte order.
+ */
+namespace flat
+{
+constexpr char magic[8] = {'A', 'W', 'L', 'F', 'L', 'A', 'T', '1'};
+constexpr std::uint32_t format_version = 1;
+constexpr std::uint32_t invalid_index = 0xFFFFFFFFU;
+constexpr std::uint32_t endianness_marker = 0x01020304U;
+
+/// the primitive is part of its layer. Primitives only reachable through other primitives (e.g.
+/// custom centerlines) are stored without it so that materialization does not add them to layers
+constexpr std::uint32_t flag_in_layer = 1U << 0U;
+
+/// masks of the layers to materialize
+namespace Layer
+{
+constexpr std::uint32_t Points = 1U << 0U;
+constexpr std::uint32_t LineStrings = 1U << 1U;
+constexpr std::uint32_t Polygons = 1U << 2U;
+constexpr std::uint32_t Lanelets = 1U << 3U;
+constexpr std::uint32_t Areas = 1U << 4U;
+constexpr std::uint32_t RegulatoryElements = 1U << 5U;
+constexpr std::uint32_t All =
+  Points | LineStrings | Polygons | Lanelets | Areas | RegulatoryElements;
+}  // namespace Layer
+
+enum class Section : std::uint32_t {
+  Points = 0,
+  LineStrings,
+  Polygons,
+  Lanelets,
+  Areas,
+  RegulatoryElements,
+  PointRefs,
+  BoundRefs,
+  Rings,
+  RegulatoryElementRefs,
+  Parameters,
+  Attributes,
+  StringOffsets,
+  StringData,
+  Count,
+};
+constexpr std::size_t section_count = static_cast<std::size_t>(Section::Count);
+
+struct SectionEntry
+{
+  std::uint64_t offset;
+  std::uint64_t count;
+};
+
+struct Header
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t endianness;
+  std::int64_t id_counter;
+  std::uint32_t section_count;
+  std::uint32_t reserved;
+  SectionEntry sections[section_count];
+};
+
+struct Range
+{
+  std::uint32_t begin;
+  std::uint32_t count;
+};
+
+struct Point
+{
+  lanelet::Id id;
+  double x;
+  double y;
+  double z;
+  Range attributes;
+  std::uint32_t flags;
+  std::uint32_t reserved;
+};
+
+/// shared by linestrings and polygons, points refer to Section::PointRefs
+struct LineString
+{
+  lanelet::Id id;
+  Range points;
+  Range attributes;
+  std::uint32_t flags;
+  std::uint32_t reserved;
+};
+
+struct BoundRef
+{
+  std::uint32_t linestring;
+  std::uint32_t inverted;
+};
+
+/// a closed ring of an area, made of Section::BoundRefs
+struct Ring
+{
+  Range bounds;
+};
+
+struct Box
+{
+  double min_x;
+  double min_y;
+  double max_x;
+  double max_y;
+};
+
+struct Lanelet
+{
+  lanelet::Id id;
+  BoundRef left;
+  BoundRef right;
+  std::uint32_t centerline;  // index of a linestring or invalid_index
+  std::uint32_t flags;
+  Box bbox;
+  Range attributes;
+  Range regulatory_elements;  // refers to Section::RegulatoryElementRefs
+};
+
+struct Area
+{
+  lanelet::Id id;
+  std::uint32_t outer_ring;
+  std::uint32_t flags;
+  Range inner_rings;
+  Box bbox;
+  Range attributes;
+  Range regulatory_elements;
+};
+
+struct RegulatoryElement
+{
+  lanelet::Id id;
+  Range attributes;
+  Range parameters;
+  std::uint32_t flags;
+  std::uint32_t reserved;
+};
+
+enum class ParameterKind : std::uint32_t {
+  Point = 0,
+  LineString,
+  Polygon,
+  Lanelet,
+  Area,
+};
+
+struct Parameter
+{
+  std::uint32_t role;  // string index
+  ParameterKind kind;
+  std::uint32_t index;
+  std::uint32_t inverted;
+};
+
+struct Attribute
+{
+  std::uint32_t key;    // string index
+  std::uint32_t value;  // string index
+};
+
+struct StringOffset
+{
+  std::uint32_t begin;
+  std::uint32_t length;
+};
+
+/**
+ * [Span is a non-owning view of a section]
+ */
+template <typename T>
+class Span
+{
+public:
+  Span() = default;
+  Span(const T * data, const std::size_t size) : data_(data), size_(size) {}
+
+  const T * begin() const { return data_; }
+  const T * end() const { return data_ + size_; }
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const T & operator[](const std::size_t i) const { return data_[i]; }
+
+private:
+  const T * data_{nullptr};
+  std::size_t size_{0};
+};
+}  // namespace flat
+
+/**
+ * [FlatMapView validates a flat map buffer and gives typed access to its sections without copying
+ * it. The buffer must outlive the view. throws std::runtime_error on malformed buffers]
+ */
+class FlatMapView
+{
+public:
+  FlatMapView(const std::uint8_t * data, const std::size_t size);
+
+  lanelet::Id idCounter() const { return header_->id_counter; }
+
+  flat::Span<flat::Point> points() const { return points_; }
+  flat::Span<flat::LineString> lineStrings() const { return line_strings_; }
+  flat::Span<flat::LineString> polygons() const { return polygons_; }
+  flat::Span<flat::Lanelet> lanelets() const { return lanelets_; }
+  flat::Span<flat::Area> areas() const { return areas_; }
+  flat::Span<flat::RegulatoryElement> regulatoryElements() const { return regulatory_elements_; }
+  flat::Span<std::uint32_t> pointRefs() const { return point_refs_; }
+  flat::Span<flat::BoundRef> boundRefs() const { return bound_refs_; }
+  flat::Span<flat::Ring> rings() const { return rings_; }
+  flat::Span<std::uint32_t> regulatoryElementRefs() const { return regulatory_element_refs_; }
+  flat::Span<flat::Parameter> parameters() const { return parameters_; }
+  flat::Span<flat::Attribute> attributes() const { return attributes_; }
+
+  /**
+   * [string returns an entry of the string table. throws std::out_of_range on a bad index]
+   */
+  std::string_view string(const std::uint32_t index) const;
+
+  std::optional<std::uint32_t> findPoint(const lanelet::Id id) const;
+  std::optional<std::uint32_t> findLineString(const lanelet::Id id) const;
+  std::optional<std::uint32_t> findPolygon(const lanelet::Id id) const;
+  std::optional<std::uint32_t> findLanelet(const lanelet::Id id) const;
+  std::optional<std::uint32_t> findArea(const lanelet::Id id) const;
+  std::optional<std::uint32_t> findRegulatoryElement(const lanelet::Id id) const;
+
+  /**
+   * [laneletsInBox returns the indices of the lanelets whose bounding box intersects box. Only the
+   * lanelet records are read]
+   */
+  std::vector<std::uint32_t> laneletsInBox(const lanelet::BoundingBox2d & box) const;
+
+private:
+  const flat::Header * header_{nullptr};
+  flat::Span<flat::Point> points_;
+  flat::Span<flat::LineString> line_strings_;
+  flat::Span<flat::LineString> polygons_;
+  flat::Span<flat::Lanelet> lanelets_;
+  flat::Span<flat::Area> areas_;
+  flat::Span<flat::RegulatoryElement> regulatory_elements_;
+  flat::Span<std::uint32_t> point_refs_;
+  flat::Span<flat::BoundRef> bound_refs_;
+  flat::Span<flat::Ring> rings_;
+  flat::Span<std::uint32_t> regulatory_element_refs_;
+  flat::Span<flat::Parameter> parameters_;
+  flat::Span<flat::Attribute> attributes_;
+  flat::Span<flat::StringOffset> string_offsets_;
+  flat::Span<char> string_data_;
+};
+
+/**
+ * [FlatMapFile maps a flat map file read-only into memory. Pages are shared through the page cache
+ * by every process mapping the same file. throws std::runtime_error if the file cannot be mapped
+ * or is malformed]
+ */
+class FlatMapFile
+{
+public:
+  explicit FlatMapFile(const std::string & filename);
+  ~FlatMapFile();
+
+  FlatMapFile(const FlatMapFile &) = delete;
+  FlatMapFile & operator=(const FlatMapFile &) = delete;
+  FlatMapFile(FlatMapFile &&) = delete;
+  FlatMapFile & operator=(FlatMapFile &&) = delete;
+
+  const FlatMapView & view() const { return *view_; }
+
+private:
+  void * address_{nullptr};
+  std::size_t size_{0};
+  std::optional<FlatMapView> view_;
+};
+
+/**
+ * [writeFlatMap converts a map into the flat format]
+ * @param map  [lanelet map]
+ * @param data [flat map buffer, overwritten]
+ */
+void writeFlatMap(const lanelet::LaneletMap & map, std::vector<std::uint8_t> * data);
+
+/**
+ * [writeFlatMap writes a map into a flat map file. throws std::runtime_error on I/O errors]
+ */
+void writeFlatMap(const lanelet::LaneletMap & map, const std::string & filename);
+
+/**
+ * [materialize builds a complete LaneletMap from a flat map and registers its id counter]
+ */
+lanelet::LaneletMapPtr materialize(const FlatMapView & view);
+
+/**
+ * [materialize builds a LaneletMap whose layers are filled only for the requested kinds. Primitives
+ * of other kinds are still built when a requested one refers to them (e.g. the bounds of a
+ * lanelet), but they are not added to their layers]
+ * @param view   [flat map]
+ * @param layers [mask of flat::Layer values]
+ */
+lanelet::LaneletMapPtr materialize(const FlatMapView & view, const std::uint32_t layers);
+
+/**
+ * [materializeLanelets builds a LaneletMap holding only the given lanelets and everything they
+ * refer to (bounds, regulatory elements and their parameters). The result can be passed to the
+ * lanelet::utils::query functions]
+ * @param view             [flat map]
+ * @param lanelet_indices  [indices into view.lanelets()]
+ */
+lanelet::LaneletMapPtr materializeLanelets(
+  const FlatMapView & view, const std::vector<std::uint32_t> & lanelet_indices);
+
+/**
+ * [materializeWithin builds a LaneletMap holding the lanelets around a region. See
+ * materializeLanelets]
+ */
+lanelet::LaneletMapPtr materializeWithin(
+  const FlatMapView & view, const lanelet::BoundingBox2d & box);
+}  // namespace lanelet::io_handlers
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__IO__FLAT_MAP_HPP_
@@ -0,0 +1,113 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__EGO_LANELET_TRACKER_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__EGO_LANELET_TRACKER_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/lanelet_subset_index.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_routing/Forward.h>
+
+#include <limits>
+#include <optional>
+#include <unordered_set>
+
+namespace lanelet::utils
+{
+/**
+ * [EgoLaneletTracker follows the lanelet of a pose over consecutive updates. Each update first
+ * tests the previous lanelet and its neighbors in the routing graph (previous, following and all
+ * lanes to the left and right). Only if the pose is inside none of them, with a direction within
+ * the yaw threshold, the tracked lanelets are searched like getClosestLaneletWithConstrains does,
+ * using a LaneletSubsetIndex. While the pose stays inside a lanelet near the previous one,
+ * overlapping lanelets elsewhere in the map are not considered]
+ */
+class EgoLaneletTracker
+{
+public:
+  /**
+   * [EgoLaneletTracker tracks the road lanelets of the map]
+   * @param lanelet_map_ptr [lanelet map]
+   * @param routing_graph   [routing graph built on the map]
+   * @param dist_threshold  [maximum distance of the global search]
+   * @param yaw_threshold   [maximum angle between the pose and the lanelet direction]
+   */
+  EgoLaneletTracker(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+    const lanelet::routing::RoutingGraphConstPtr & routing_graph,
+    const double dist_threshold = std::numeric_limits<double>::max(),
+    const double yaw_threshold = std::numeric_limits<double>::max());
+
+  /**
+   * [EgoLaneletTracker tracks the lanelets of the index, e.g. the lanelets of a route]
+   */
+  EgoLaneletTracker(
+    const LaneletSubsetIndex & index, const lanelet::routing::RoutingGraphConstPtr & routing_graph,
+    const double dist_threshold = std::numeric_limits<double>::max(),
+    const double yaw_threshold = std::numeric_limits<double>::max());
+
+  /**
+   * [update finds the lanelet of the pose]
+   * @param pose        [current pose]
+   * @param lanelet_ptr [found lanelet, unchanged if none is found]
+   * @return            [whether a lanelet was found]
+   */
+  bool update(const geometry_msgs::msg::Pose & pose, lanelet::ConstLanelet * lanelet_ptr);
+
+  /**
+   * [setCurrentLanelet sets the lanelet the next update starts from, e.g. a result kept from a
+   * previous run]
+   */
+  void setCurrentLanelet(const lanelet::ConstLanelet & lanelet);
+
+  /**
+   * [currentLanelet returns the result of the last successful update]
+   */
+  std::optional<lanelet::ConstLanelet> currentLanelet() const;
+
+  /**
+   * [reset forgets the current lanelet, so the next update searches all tracked lanelets]
+   */
+  void reset();
+
+  /**
+   * [lastUpdateWasLocal tells whether the last update was answered by the graph neighborhood]
+   */
+  bool lastUpdateWasLocal() const;
+
+private:
+  bool updateLocally(
+    const geometry_msgs::msg::Pose & pose, lanelet::ConstLanelet * lanelet_ptr) const;
+  void addNeighborhood(
+    const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * candidates) const;
+
+  LaneletSubsetIndex index_;
+  lanelet::routing::RoutingGraphConstPtr routing_graph_;
+  std::unordered_set<lanelet::Id> tracked_ids_;
+  double dist_threshold_;
+  double yaw_threshold_;
+  std::optional<lanelet::ConstLanelet> current_lanelet_;
+  bool last_update_was_local_{false};
+};
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__EGO_LANELET_TRACKER_HPP_
@@ -0,0 +1,95 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__LANELET_GEOMETRY_CACHE_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__LANELET_GEOMETRY_CACHE_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/BoundingBox.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace lanelet::utils
+{
+/**
+ * [LaneletGeometry holds the derived geometry of one lanelet, as returned by the lanelet2 geometry
+ * functions for the lanelet in the orientation it is stored in the map]
+ */
+struct LaneletGeometry
+{
+  double length2d{0.0};                 // lanelet::geometry::length2d
+  double length3d{0.0};                 // lanelet::geometry::length3d
+  lanelet::BoundingBox2d bounding_box;  // lanelet::geometry::boundingBox2d, to reject far points
+  lanelet::BasicPolygon2d polygon;      // polygon2d().basicPolygon()
+};
+
+/**
+ * [LaneletGeometryCache stores the LaneletGeometry of a fixed collection of lanelets by id, so hot
+ * loops over a static map stop recomputing it. Building it computes every entry in parallel, which
+ * also fills the centerline cache of lanelet2 for these lanelets.
+ * The cache is a snapshot: rebuild it after the map was changed, e.g. by applyMapPatch. It can be
+ * queried from several threads and copies share the same immutable cache]
+ */
+class LaneletGeometryCache
+{
+public:
+  LaneletGeometryCache();
+
+  /**
+   * @param lanelet_map_ptr [map whose lanelet layer is cached]
+   * @param max_threads     [number of threads to compute with, 0 for the hardware concurrency]
+   */
+  explicit LaneletGeometryCache(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const std::size_t max_threads = 0);
+
+  /**
+   * @param lanelets    [lanelets to cache, duplicates and inverted lanelets are stored once]
+   * @param max_threads [number of threads to compute with, 0 for the hardware concurrency]
+   */
+  explicit LaneletGeometryCache(
+    const lanelet::ConstLanelets & lanelets, const std::size_t max_threads = 0);
+
+  /**
+   * [find returns the geometry of the lanelet, or nullptr if it is not cached or inverted. The
+   * polygon and centerline of an inverted lanelet run the other way, so callers fall back to
+   * computing its geometry]
+   */
+  const LaneletGeometry * find(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * [length2d returns the cached 2D length of the lanelet, or computes it if it is not cached]
+   */
+  double length2d(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * [length3d returns the cached 3D length of the lanelet, or computes it if it is not cached]
+   */
+  double length3d(const lanelet::ConstLanelet & lanelet) const;
+
+  std::size_t size() const;
+  bool empty() const;
+
+private:
+  struct Impl;
+  std::shared_ptr<const Impl> impl_;
+};
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__LANELET_GEOMETRY_CACHE_HPP_
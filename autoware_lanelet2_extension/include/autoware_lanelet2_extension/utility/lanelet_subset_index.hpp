@@ -0,0 +1,99 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__LANELET_SUBSET_INDEX_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__LANELET_SUBSET_INDEX_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils
+{
+/**
+ * [LaneletSubsetIndex is an R-tree over the bounding boxes of a fixed collection of lanelets, e.g.
+ * roadLanelets(laneletLayer(map)) or the lanelets of a route. It is built once and can be queried
+ * from several threads. Copies share the same immutable index.
+ * Queries return lanelets in the order of the collection the index was built from, so results
+ * equal those of the linear functions in query.hpp run on that collection]
+ */
+class LaneletSubsetIndex
+{
+public:
+  LaneletSubsetIndex();
+  explicit LaneletSubsetIndex(const lanelet::ConstLanelets & lanelets);
+
+  /**
+   * [lanelets returns the collection the index was built from]
+   */
+  const lanelet::ConstLanelets & lanelets() const;
+
+  std::size_t size() const;
+  bool empty() const;
+
+  /**
+   * [contains finds the lanelets containing the point, see lanelet::geometry::inside]
+   * @param point [2D search point]
+   * @return      [lanelets containing the point]
+   */
+  lanelet::ConstLanelets contains(const lanelet::BasicPoint2d & point) const;
+
+  /**
+   * [nearest finds the k lanelets with the smallest 2D polygon distance to the point, nearest
+   * first. Lanelets at the same distance keep the order of the collection]
+   * @param point [2D search point]
+   * @param k     [maximum number of lanelets]
+   * @return      [at most k lanelets]
+   */
+  lanelet::ConstLanelets nearest(const lanelet::BasicPoint2d & point, const std::size_t k) const;
+
+  /**
+   * [withinRange finds the lanelets whose 2D polygon is at most range away from the point]
+   * @param point [2D search point]
+   * @param range [maximum distance]
+   * @return      [lanelets within range]
+   */
+  lanelet::ConstLanelets withinRange(const lanelet::BasicPoint2d & point, const double range) const;
+
+  /**
+   * [distancesWithinRange is the same as withinRange, but also returns the 2D polygon distance of
+   * every lanelet it found, so that callers ranking them need not measure it again]
+   * @param point [2D search point]
+   * @param range [maximum distance]
+   * @return      [lanelets within range and their distance to the point]
+   */
+  std::vector<std::pair<lanelet::ConstLanelet, double>> distancesWithinRange(
+    const lanelet::BasicPoint2d & point, const double range) const;
+
+  /**
+   * [intersecting finds the lanelets whose 2D polygon intersects the given polygon]
+   * @param polygon [2D search polygon]
+   * @return        [intersecting lanelets]
+   */
+  lanelet::ConstLanelets intersecting(const lanelet::BasicPolygon2d & polygon) const;
+
+private:
+  struct Impl;
+  std::shared_ptr<const Impl> impl_;
+};
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__LANELET_SUBSET_INDEX_HPP_
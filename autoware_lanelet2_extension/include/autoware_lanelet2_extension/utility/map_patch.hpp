@@ -0,0 +1,210 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__MAP_PATCH_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__MAP_PATCH_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/io/flat_map.hpp"
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <lanelet2_core/Attribute.h>
+#include <lanelet2_core/Forward.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lanelet::utils
+{
+/**
+ * [MapPatch is the difference between two versions of a map. Primitives refer to each other by id;
+ * a referenced primitive is only stored when it was added or changed, otherwise it is looked up in
+ * the map the patch is applied to]
+ */
+struct MapPatch
+{
+  struct Point
+  {
+    lanelet::Id id{lanelet::InvalId};
+    double x{0.0};
+    double y{0.0};
+    double z{0.0};
+    lanelet::AttributeMap attributes;
+    bool in_layer{true};  // false for points only reachable through a custom centerline
+  };
+
+  /// used for linestrings and polygons
+  struct LineString
+  {
+    lanelet::Id id{lanelet::InvalId};
+    std::vector<lanelet::Id> points;
+    lanelet::AttributeMap attributes;
+    bool in_layer{true};  // false for custom centerlines
+  };
+
+  struct Bound
+  {
+    lanelet::Id id{lanelet::InvalId};
+    bool inverted{false};
+
+    bool operator==(const Bound & other) const
+    {
+      return id == other.id && inverted == other.inverted;
+    }
+    bool operator!=(const Bound & other) const { return !(*this == other); }
+  };
+
+  struct Lanelet
+  {
+    lanelet::Id id{lanelet::InvalId};
+    Bound left;
+    Bound right;
+    lanelet::Id centerline{lanelet::InvalId};  // InvalId if the centerline is computed
+    std::vector<lanelet::Id> regulatory_elements;
+    lanelet::AttributeMap attributes;
+  };
+
+  struct Area
+  {
+    lanelet::Id id{lanelet::InvalId};
+    std::vector<Bound> outer;
+    std::vector<std::vector<Bound>> inner;
+    std::vector<lanelet::Id> regulatory_elements;
+    lanelet::AttributeMap attributes;
+  };
+
+  struct Parameter
+  {
+    std::string role;
+    lanelet::io_handlers::flat::ParameterKind kind{
+      lanelet::io_handlers::flat::ParameterKind::Point};
+    lanelet::Id id{lanelet::InvalId};
+    bool inverted{false};
+
+    bool operator==(const Parameter & other) const
+    {
+      return role == other.role && kind == other.kind && id == other.id &&
+             inverted == other.inverted;
+    }
+    bool operator!=(const Parameter & other) const { return !(*this == other); }
+  };
+
+  struct RegulatoryElement
+  {
+    lanelet::Id id{lanelet::InvalId};
+    std::vector<Parameter> parameters;
+    lanelet::AttributeMap attributes;
+  };
+
+  /// added or changed primitives, stored with their new content
+  std::vector<Point> points;
+  std::vector<LineString> line_strings;
+  std::vector<LineString> polygons;
+  std::vector<Lanelet> lanelets;
+  std::vector<Area> areas;
+  std::vector<RegulatoryElement> regulatory_elements;
+
+  /// ids of the primitives removed from their layers
+  std::vector<lanelet::Id> removed_points;
+  std::vector<lanelet::Id> removed_line_strings;
+  std::vector<lanelet::Id> removed_polygons;
+  std::vector<lanelet::Id> removed_lanelets;
+  std::vector<lanelet::Id> removed_areas;
+  std::vector<lanelet::Id> removed_regulatory_elements;
+
+  /// global id counter of the new map, registered when the patch is applied
+  lanelet::Id id_counter{lanelet::InvalId};
+
+  /// computeFingerprint of the map the patch was computed against, 0 to apply it unchecked
+  std::uint64_t base_fingerprint{0};
+
+  /// computeFingerprint of the map the patch turns it into, to check the next patch against
+  std::uint64_t fingerprint{0};
+
+  bool empty() const;
+};
+
+/**
+ * [computeMapPatch computes the primitives added, changed and removed between two maps. Primitives
+ * are matched by id. Both maps must be complete, i.e. every primitive referred to by a layer must
+ * be in its own layer, except custom centerlines]
+ * @param old_map [map the subscribers already have]
+ * @param new_map [map to publish]
+ * @return        [patch turning old_map into new_map]
+ */
+MapPatch computeMapPatch(const lanelet::LaneletMap & old_map, const lanelet::LaneletMap & new_map);
+
+/**
+ * [applyMapPatch updates a map in place and registers the id counter of the patch. Primitives keep
+ * their identity, so handles held by the caller stay valid and see the new content, and primitives
+ * the patch does not refer to are left as they are.
+ * Only patches that change attributes or add primitives cost O(changed primitives). lanelet2 can
+ * neither remove primitives from a layer nor move them in its search trees, so a patch that moves a
+ * point, changes the points of a linestring, the bounds of a lanelet or area or the parameters of a
+ * regulatory element, or removes anything rebuilds the layers of the map, which is O(map) and
+ * usually the case for geometry fixes. Centerlines computed from moved bounds are dropped and
+ * computed again on their next use.
+ * throws std::runtime_error, before the map is modified, if map_fingerprint differs from the one
+ * the patch was computed against or if the patch refers to primitives missing in the map.
+ * The map is not hashed here. Pass the fingerprint the map was loaded with, e.g. from
+ * peekFingerprint, and patch.fingerprint after applying a patch]
+ * @param patch           [patch computed against the content of map]
+ * @param map             [map to update]
+ * @param map_fingerprint [computeFingerprint of map, 0 to skip the check]
+ */
+void applyMapPatch(
+  const MapPatch & patch, const lanelet::LaneletMapPtr & map,
+  const std::uint64_t map_fingerprint = 0);
+
+namespace conversion
+{
+/**
+ * [toPatchMsg serializes a patch into LaneletMapBin::data. The payload is flagged so that
+ * fromBinMsg rejects it instead of decoding it as a full map]
+ * @param patch       [map patch]
+ * @param msg         [converted ROS message. Only "data" field is filled]
+ * @param compression [encoding of msg->data]
+ */
+void toPatchMsg(
+  const MapPatch & patch, autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgCompression compression = BinMsgCompression::None);
+
+/**
+ * [isPatchMsg checks whether a LaneletMapBin carries a patch rather than a full map]
+ */
+bool isPatchMsg(const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * [fromPatchMsg deserializes a patch. throws std::runtime_error on malformed payloads]
+ * @param msg   [ROS message created by toPatchMsg]
+ * @param patch [deserialized patch]
+ */
+void fromPatchMsg(const autoware_map_msgs::msg::LaneletMapBin & msg, MapPatch * patch);
+
+/**
+ * [applyPatchMsg deserializes a patch and applies it to map. See applyMapPatch]
+ */
+void applyPatchMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, const lanelet::LaneletMapPtr & map,
+  const std::uint64_t map_fingerprint = 0);
+}  // namespace conversion
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__MAP_PATCH_HPP_
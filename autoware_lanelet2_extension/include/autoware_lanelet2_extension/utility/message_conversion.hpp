@@ -19,6 +19,8 @@
 
 // NOLINTBEGIN(readability-identifier-naming)
 
+#include "autoware_lanelet2_extension/io/flat_map.hpp"
+
 #include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/point32.hpp>
@@ -28,20 +30,92 @@
 #include <lanelet2_routing/Forward.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <cstdint>
+#include <optional>
+
 namespace lanelet::utils::conversion
 {
+/**
+ * [BinMsgCompression selects how toBinMsg encodes LaneletMapBin::data. Payloads carry a small
+ * header, which fromBinMsg detects, so subscribers do not need to know the encoding]
+ */
+enum class BinMsgCompression : std::uint8_t {
+  None = 0,
+  LZ4 = 1,   // fast to decode, moderate ratio
+  Zstd = 2,  // slower to decode, best ratio
+};
+
+/**
+ * [BinMsgFormat selects the layout of the decoded payload. Flat stores the map in the sectioned
+ * layout of io/flat_map.hpp, which lets fromBinMsg decode only some layers. Legacy writes the
+ * headerless boost archive for subscribers built before the header existed. It has no fingerprint,
+ * so peekFingerprint cannot read one and fromBinMsgShared hashes the whole payload instead, and it
+ * can be neither compressed nor carry a routing graph]
+ */
+enum class BinMsgFormat : std::uint8_t {
+  Boost = 0,
+  Flat = 1,
+  Legacy = 2,
+};
+
+/**
+ * [BinMsgLayer masks the layers fromBinMsg fills, e.g. BinMsgLayer::Lanelets | BinMsgLayer::Areas]
+ */
+namespace BinMsgLayer = lanelet::io_handlers::flat::Layer;
+
 /**
  * [toBinMsg converts lanelet2 map to ROS message. Similar implementation to
- * lanelet::io_handlers::BinHandler::write()]
+ * lanelet::io_handlers::BinHandler::write(), but the payload starts with a header holding the
+ * fingerprint of the map. Use BinMsgFormat::Legacy for subscribers built before the header
+ * existed]
  * @param map [lanelet map data]
  * @param msg [converted ROS message. Only "data" field is filled]
  */
 [[deprecated("please use autoware::lanelet2_utils::to_autoware_map_msgs instead")]] void toBinMsg(
   const lanelet::LaneletMapPtr & map, autoware_map_msgs::msg::LaneletMapBin * msg);
 
+/**
+ * [toBinMsg converts lanelet2 map to ROS message with the given payload encoding. The header of the
+ * payload holds the fingerprint of the map, see computeFingerprint]
+ * @param map         [lanelet map data]
+ * @param msg         [converted ROS message. Only "data" field is filled]
+ * @param compression [encoding of msg->data]
+ */
+void toBinMsg(
+  const lanelet::LaneletMapPtr & map, autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgCompression compression);
+
+/**
+ * [toBinMsg converts lanelet2 map to ROS message with the given payload layout]
+ * @param map         [lanelet map data]
+ * @param msg         [converted ROS message. Only "data" field is filled]
+ * @param format      [layout of the decoded payload]
+ * @param compression [encoding of msg->data]
+ */
+void toBinMsg(
+  const lanelet::LaneletMapPtr & map, autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgFormat format, const BinMsgCompression compression = BinMsgCompression::None);
+
+/**
+ * [toBinMsg converts lanelet2 map and a routing graph built on it to ROS message. Subscribers
+ * using the same traffic rules and the same first routing cost restore the embedded graph instead
+ * of building it. Only routing cost id 0 is embedded, subscribers compute the costs of their other
+ * routing costs for the embedded edges]
+ * @param map           [lanelet map data]
+ * @param routing_graph [routing graph built on map with traffic_rules]
+ * @param traffic_rules [traffic rules the routing graph was built with]
+ * @param msg           [converted ROS message. Only "data" field is filled]
+ * @param compression   [encoding of msg->data]
+ */
+void toBinMsg(
+  const lanelet::LaneletMapPtr & map, const lanelet::routing::RoutingGraphConstPtr & routing_graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgCompression compression = BinMsgCompression::None);
+
 /**
  * [fromBinMsg converts ROS message into lanelet2 data. Similar implementation
- * to lanelet::io_handlers::BinHandler::parse()]
+ * to lanelet::io_handlers::BinHandler::parse(). Compressed payloads are detected automatically]
  * @param msg [ROS message for lanelet map]
  * @param map [Converted lanelet2 data]
  */
@@ -55,6 +129,82 @@ fromBinMsg(
   lanelet::traffic_rules::TrafficRulesPtr * traffic_rules,
   lanelet::routing::RoutingGraphPtr * routing_graph);
 
+/**
+ * [fromBinMsg converts ROS message into lanelet2 data, filling only the requested layers.
+ * Primitives referred to by a requested layer (e.g. lanelet bounds) are still built but not added
+ * to their own layer. Payloads not written with BinMsgFormat::Flat are decoded completely]
+ * @param msg    [ROS message for lanelet map]
+ * @param map    [Converted lanelet2 data]
+ * @param layers [mask of BinMsgLayer values]
+ */
+void fromBinMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
+  const std::uint32_t layers);
+
+/**
+ * [fromBinMsg converts ROS message into lanelet2 map and a routing graph with the default routing
+ * costs of lanelet2. The embedded routing graph is restored as by the overload taking routing
+ * costs, e.g. when the publisher built it with the default routing costs too]
+ * @param msg           [ROS message for lanelet map]
+ * @param map           [Converted lanelet2 data]
+ * @param traffic_rules [traffic rules used for routing, e.g. lanelet::autoware::AutowareVehicle]
+ * @param routing_graph [built routing graph]
+ */
+void fromBinMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
+  const lanelet::traffic_rules::TrafficRulesPtr & traffic_rules,
+  lanelet::routing::RoutingGraphPtr * routing_graph);
+
+/**
+ * [fromBinMsg converts ROS message into lanelet2 map and routing graph. The routing graph embedded
+ * by toBinMsg is restored if it was built on the same map with traffic rules giving the same
+ * answers and with the first of routing_costs as its routing cost id 0, otherwise a new one is
+ * built. The edges of the other routing costs are added to the restored graph]
+ * @param msg           [ROS message for lanelet map]
+ * @param map           [Converted lanelet2 data]
+ * @param traffic_rules [traffic rules used for routing, e.g. lanelet::autoware::AutowareVehicle]
+ * @param routing_costs [routing costs of the graph, e.g. lanelet::routing::defaultRoutingCosts()]
+ * @param routing_graph [restored or built routing graph]
+ */
+void fromBinMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
+  const lanelet::traffic_rules::TrafficRulesPtr & traffic_rules,
+  const lanelet::routing::RoutingCostPtrs & routing_costs,
+  lanelet::routing::RoutingGraphPtr * routing_graph);
+
+/**
+ * [computeFingerprint computes a content hash of a map. It covers ids, coordinates, attributes and
+ * references of every primitive in the layers and does not depend on the order in which they were
+ * added, so maps with the same content have the same fingerprint in every process. toBinMsg stores
+ * it in the header of every payload except those written with BinMsgFormat::Legacy]
+ */
+std::uint64_t computeFingerprint(const lanelet::LaneletMap & map);
+
+/**
+ * [peekFingerprint reads the fingerprint from the payload header without decoding the map]
+ * @param msg [ROS message for lanelet map]
+ * @return    [fingerprint, std::nullopt for BinMsgFormat::Legacy payloads and patches]
+ */
+std::optional<std::uint64_t> peekFingerprint(const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * [fromBinMsgShared converts ROS message into lanelet2 data, decoding each map at most once per
+ * process: the last decoded map is kept and handed out again when a payload with the same
+ * fingerprint arrives, e.g. after a node was relaunched in the same container. Legacy payloads,
+ * which have no fingerprint, are recognized by a hash of their bytes. The returned map is shared
+ * with callers on other threads and must be treated as read-only: its centerlines are computed
+ * with warmUpMap before it is handed out, but overwriting centerlines or any other modification
+ * races with the other users. Copy the map before modifying it]
+ * @param msg [ROS message for lanelet map]
+ * @return    [shared lanelet2 data]
+ */
+lanelet::LaneletMapConstPtr fromBinMsgShared(const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * [clearBinMsgCache releases the map kept by fromBinMsgShared]
+ */
+void clearBinMsgCache();
+
 /**
  * [toGeomMsgPt converts various point types to geometry_msgs point]
  * @param src [input point(geometry_msgs::msg::Point3,
@@ -0,0 +1,88 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__PRIMITIVE_TYPE_INDEX_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__PRIMITIVE_TYPE_INDEX_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/LineString.h>
+#include <lanelet2_core/primitives/Polygon.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lanelet::utils
+{
+/**
+ * [PrimitiveTypeIndex groups the linestrings and polygons of a map by their type and subtype
+ * attributes, and collects the waypoints of its lanelets. Primitives without type or subtype are
+ * grouped under "none", like the getAll* functions in query.hpp treat them. Within a group
+ * primitives keep the order of their layer.
+ * The index is a snapshot built in one pass over the layers: rebuild it after the map was
+ * changed, e.g. by applyMapPatch. It can be queried from several threads and copies share the
+ * same immutable index]
+ */
+class PrimitiveTypeIndex
+{
+public:
+  PrimitiveTypeIndex();
+  explicit PrimitiveTypeIndex(const lanelet::LaneletMapConstPtr & lanelet_map_ptr);
+
+  /**
+   * [lineStrings returns the linestrings of the given type of any subtype]
+   */
+  const lanelet::ConstLineStrings3d & lineStrings(const std::string & type) const;
+
+  /**
+   * [lineStrings returns the linestrings of the given type and subtype]
+   */
+  const lanelet::ConstLineStrings3d & lineStrings(
+    const std::string & type, const std::string & subtype) const;
+
+  /**
+   * [lineStringsOfTypes returns the linestrings of any of the given types in the order of their
+   * layer, like a single pass over the layer comparing the type with each of them]
+   */
+  lanelet::ConstLineStrings3d lineStringsOfTypes(const std::vector<std::string> & types) const;
+
+  /**
+   * [polygons returns the polygons of the given type of any subtype]
+   */
+  const lanelet::ConstPolygons3d & polygons(const std::string & type) const;
+
+  /**
+   * [polygons returns the polygons of the given type and subtype]
+   */
+  const lanelet::ConstPolygons3d & polygons(
+    const std::string & type, const std::string & subtype) const;
+
+  /**
+   * [waypoints returns the linestrings referred to by the waypoints attribute of lanelets, in the
+   * order of the lanelet layer. Attributes that are no id or refer to linestrings missing in the
+   * map are skipped, where getAllWaypoints on the map throws]
+   */
+  const lanelet::ConstLineStrings3d & waypoints() const;
+
+private:
+  struct Impl;
+  std::shared_ptr<const Impl> impl_;
+};
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__PRIMITIVE_TYPE_INDEX_HPP_
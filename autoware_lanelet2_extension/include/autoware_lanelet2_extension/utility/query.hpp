@@ -25,6 +25,10 @@
 #include "autoware_lanelet2_extension/regulatory_elements/no_parking_area.hpp"
 #include "autoware_lanelet2_extension/regulatory_elements/no_stopping_area.hpp"
 #include "autoware_lanelet2_extension/regulatory_elements/speed_bump.hpp"
+#include "autoware_lanelet2_extension/utility/lanelet_geometry_cache.hpp"
+#include "autoware_lanelet2_extension/utility/lanelet_subset_index.hpp"
+#include "autoware_lanelet2_extension/utility/primitive_type_index.hpp"
+#include "autoware_lanelet2_extension/utility/regulatory_element_index.hpp"
 
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
@@ -33,8 +37,12 @@
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_routing/RoutingGraph.h>
 
+#include <cstddef>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace lanelet::utils::query
@@ -70,6 +78,57 @@ lanelet::ConstLanelets shoulderLanelets(const lanelet::ConstLanelets & lls);
  */
 lanelet::ConstLanelets bicycleLaneLanelets(const lanelet::ConstLanelets & lls);
 
+/**
+ * [regulatoryElementsOfType extracts regulatory elements of the given type from lanelets, each
+ * element once in the order it is first referenced]
+ * @param lanelets [input lanelets]
+ * @return         [regulatory elements of type RegulatoryElementT associated with input lanelets]
+ */
+template <typename RegulatoryElementT>
+std::vector<std::shared_ptr<const RegulatoryElementT>> regulatoryElementsOfType(
+  const lanelet::ConstLanelets & lanelets)
+{
+  std::vector<std::shared_ptr<const RegulatoryElementT>> regulatory_elements;
+  regulatory_elements.reserve(lanelets.size());
+  std::unordered_set<lanelet::Id> found_ids;
+  found_ids.reserve(lanelets.size());
+
+  for (const auto & ll : lanelets) {
+    for (const auto & regulatory_element : ll.regulatoryElementsAs<RegulatoryElementT>()) {
+      if (found_ids.insert(regulatory_element->id()).second) {
+        regulatory_elements.push_back(regulatory_element);
+      }
+    }
+  }
+  return regulatory_elements;
+}
+
+/**
+ * [regulatoryElementsOfType extracts regulatory elements of the given type from lanelets using a
+ * prebuilt index of the map, with the same result as the overload without index]
+ * @param index    [regulatory element index of the map of the lanelets]
+ * @param lanelets [input lanelets]
+ * @return         [regulatory elements of type RegulatoryElementT associated with input lanelets]
+ */
+template <typename RegulatoryElementT>
+std::vector<std::shared_ptr<const RegulatoryElementT>> regulatoryElementsOfType(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  std::vector<std::shared_ptr<const RegulatoryElementT>> regulatory_elements;
+  regulatory_elements.reserve(lanelets.size());
+  std::unordered_set<lanelet::Id> found_ids;
+  found_ids.reserve(lanelets.size());
+
+  for (const auto & ll : lanelets) {
+    for (const auto & regulatory_element : index.regulatoryElementsAs<RegulatoryElementT>(ll)) {
+      if (found_ids.insert(regulatory_element->id()).second) {
+        regulatory_elements.push_back(regulatory_element);
+      }
+    }
+  }
+  return regulatory_elements;
+}
+
 /**
  * [trafficLights extracts Traffic Light regulatory element from lanelets]
  * @param lanelets [input lanelets]
@@ -130,6 +189,25 @@ std::vector<lanelet::SpeedBumpConstPtr> speedBumps(const lanelet::ConstLanelets
  */
 std::vector<lanelet::CrosswalkConstPtr> crosswalks(const lanelet::ConstLanelets & lanelets);
 
+// the overloads below take a RegulatoryElementIndex of the map to avoid casting the regulatory
+// elements of every lanelet on each call
+std::vector<lanelet::TrafficLightConstPtr> trafficLights(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::AutowareTrafficLightConstPtr> autowareTrafficLights(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::DetectionAreaConstPtr> detectionAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::NoStoppingAreaConstPtr> noStoppingAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::NoParkingAreaConstPtr> noParkingAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::BusStopAreaConstPtr> busStopAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::SpeedBumpConstPtr> speedBumps(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+std::vector<lanelet::CrosswalkConstPtr> crosswalks(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets);
+
 // query all curbstones in lanelet2 map
 lanelet::ConstLineStrings3d curbstones(const lanelet::LaneletMapConstPtr & lanelet_map_ptr);
 
@@ -165,6 +243,22 @@ lanelet::ConstLineStrings3d getAllParkingSpaces(
 // query all waypoints in lanelet2 map
 lanelet::ConstLineStrings3d getAllWaypoints(const lanelet::LaneletMapConstPtr & lanelet_map_ptr);
 
+// the overloads below take a PrimitiveTypeIndex of the map instead of scanning its layers
+lanelet::ConstLineStrings3d curbstones(const PrimitiveTypeIndex & index);
+lanelet::ConstPolygons3d getAllObstaclePolygons(const PrimitiveTypeIndex & index);
+lanelet::ConstPolygons3d getAllParkingLots(const PrimitiveTypeIndex & index);
+lanelet::ConstLineStrings3d getAllLinestringsWithType(
+  const PrimitiveTypeIndex & index, const std::string & type);
+lanelet::ConstLineStrings3d getAllPartitions(const PrimitiveTypeIndex & index);
+lanelet::ConstLineStrings3d getAllFences(const PrimitiveTypeIndex & index);
+lanelet::ConstLineStrings3d getAllPedestrianPolygonMarkings(const PrimitiveTypeIndex & index);
+lanelet::ConstLineStrings3d getAllPedestrianLineMarkings(const PrimitiveTypeIndex & index);
+lanelet::ConstLineStrings3d getAllParkingSpaces(const PrimitiveTypeIndex & index);
+// skips waypoints attributes that are no id or refer to missing linestrings instead of throwing
+lanelet::ConstLineStrings3d getAllWaypoints(const PrimitiveTypeIndex & index);
+lanelet::ConstPolygons3d getAllPolygonsByType(
+  const PrimitiveTypeIndex & index, const std::string & polygon_type);
+
 // query linked parking spaces from lanelet
 lanelet::ConstLineStrings3d getLinkedParkingSpaces(
   const lanelet::ConstLanelet & lanelet, const lanelet::LaneletMapConstPtr & lanelet_map_ptr);
@@ -275,6 +369,53 @@ ConstLanelets getLaneletsWithinRange(
   const lanelet::ConstLanelets & lanelets, const geometry_msgs::msg::Point & search_point,
   const double range);
 
+/**
+ * [getLaneletsWithinRange finds the lanelets of the map within range of the search point. The
+ * R-tree of the lanelet layer yields the lanelets whose bounding box is within range, only those
+ * get an exact polygon distance. Gives the same lanelets as the overload taking laneletLayer(map),
+ * sorted by id]
+ * @param lanelet_map_ptr [lanelet map to search in]
+ * @param search_point    [point to search around]
+ * @param range           [maximum 2D distance between lanelet polygon and point]
+ * @return                [lanelets within range]
+ */
+ConstLanelets getLaneletsWithinRange(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::BasicPoint2d & search_point,
+  const double range);
+
+ConstLanelets getLaneletsWithinRange(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const geometry_msgs::msg::Point & search_point, const double range);
+
+/**
+ * [getLaneletsWithinRange is the same as above, but takes the lanelet polygons from the cache
+ * instead of building them for every candidate]
+ * @param lanelet_map_ptr [lanelet map to search in]
+ * @param search_point    [point to search around]
+ * @param range           [maximum 2D distance between lanelet polygon and point]
+ * @param geometry_cache  [geometry of the lanelets of the map]
+ * @return                [lanelets within range]
+ */
+ConstLanelets getLaneletsWithinRange(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::BasicPoint2d & search_point,
+  const double range, const LaneletGeometryCache & geometry_cache);
+
+/**
+ * [getLaneletsWithinRange finds the lanelets of the index within range of the search point, in
+ * the order of the collection the index was built from]
+ * @param index        [index over the lanelets to search]
+ * @param search_point [point to search around]
+ * @param range        [maximum 2D distance between lanelet polygon and point]
+ * @return             [lanelets within range]
+ */
+ConstLanelets getLaneletsWithinRange(
+  const LaneletSubsetIndex & index, const lanelet::BasicPoint2d & search_point,
+  const double range);
+
+ConstLanelets getLaneletsWithinRange(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Point & search_point,
+  const double range);
+
 [[deprecated("please use autoware::lanelet2_utils::lane_changeable_neighbors")]] ConstLanelets
 getLaneChangeableNeighbors(const routing::RoutingGraphPtr & graph, const ConstLanelet & lanelet);
 
@@ -302,6 +443,45 @@ getClosestLanelet(
   const ConstLanelets & lanelets, const geometry_msgs::msg::Pose & search_pose,
   ConstLanelet * closest_lanelet_ptr);
 
+/**
+ * [getClosestLanelet finds the lanelet of the map closest to the search pose. Lanelets are visited
+ * through the R-tree of the lanelet layer in order of their bounding box distance, until that
+ * distance exceeds the closest polygon found. Lanelets at the same distance are told apart by the
+ * direction of their centerline, like in the overload taking laneletLayer(map)]
+ * @param lanelet_map_ptr     [lanelet map to search in]
+ * @param search_pose         [pose to search for, only x, y and yaw are used]
+ * @param closest_lanelet_ptr [found lanelet]
+ * @return                    [whether a lanelet was found]
+ */
+bool getClosestLanelet(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelet * closest_lanelet_ptr);
+
+/**
+ * [getClosestLanelet finds the lanelet of the index closest to the search pose. Lanelets at the
+ * same distance are told apart by the direction of their centerline, visiting them in the order of
+ * the collection the index was built from]
+ * @param index               [index over the lanelets to search]
+ * @param search_pose         [pose to search for, only x, y and yaw are used]
+ * @param closest_lanelet_ptr [found lanelet]
+ * @return                    [whether a lanelet was found]
+ */
+bool getClosestLanelet(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelet * closest_lanelet_ptr);
+
+/**
+ * [getClosestLaneletWithConstrains finds the closest lanelet of the index within dist_threshold
+ * whose direction differs at most yaw_threshold from the search pose. Only lanelets within
+ * dist_threshold get an exact distance, measured once on the polygons the index holds, so there is
+ * no overload taking a LaneletGeometryCache]
+ */
+bool getClosestLaneletWithConstrains(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelet * closest_lanelet_ptr,
+  const double dist_threshold = std::numeric_limits<double>::max(),
+  const double yaw_threshold = std::numeric_limits<double>::max());
+
 [[deprecated("please use autoware::lanelet2_utils::get_closest_lanelet_within_constraint instead")]]
 bool getClosestLaneletWithConstrains(
   const ConstLanelets & lanelets, const geometry_msgs::msg::Pose & search_pose,
@@ -319,6 +499,73 @@ getCurrentLanelets(
   const ConstLanelets & lanelets, const geometry_msgs::msg::Pose & search_pose,
   ConstLanelets * current_lanelets_ptr);
 
+/**
+ * [getCurrentLanelets finds the lanelets of the map containing the search point. Only lanelets
+ * whose bounding box contains the point are tested, found through the R-tree of the lanelet layer.
+ * Gives the same lanelets as the overload taking laneletLayer(map), sorted by id]
+ * @param lanelet_map_ptr      [lanelet map to search in]
+ * @param search_point         [point to search for, only x and y are used]
+ * @param current_lanelets_ptr [found lanelets are appended]
+ * @return                     [whether a lanelet was found]
+ */
+bool getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const geometry_msgs::msg::Point & search_point, ConstLanelets * current_lanelets_ptr);
+
+/**
+ * [getCurrentLanelets finds the lanelets of the map containing the position of the search pose,
+ * see the overload taking a point]
+ */
+bool getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelets * current_lanelets_ptr);
+
+/**
+ * [getCurrentLanelets finds the lanelets of the index containing the search point, in the order of
+ * the collection the index was built from]
+ * @param index                [index over the lanelets to search]
+ * @param search_point         [point to search for, only x and y are used]
+ * @param current_lanelets_ptr [found lanelets are appended]
+ * @return                     [whether a lanelet was found]
+ */
+bool getCurrentLanelets(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Point & search_point,
+  ConstLanelets * current_lanelets_ptr);
+
+bool getCurrentLanelets(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelets * current_lanelets_ptr);
+
+/**
+ * [getCurrentLanelets finds the lanelets of the map containing each of the search points. Works
+ * best on consecutive points, e.g. of a trajectory, which are searched in small groups sharing one
+ * R-tree query. result[i] equals the lanelets found by the single point overload for
+ * search_points[i]]
+ * @param lanelet_map_ptr [lanelet map to search in]
+ * @param search_points   [points to search for, only x and y are used]
+ * @param max_threads     [number of threads to search with, 0 for the hardware concurrency]
+ * @return                [lanelets containing each point, sorted by id]
+ */
+std::vector<ConstLanelets> getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const std::vector<geometry_msgs::msg::Point> & search_points, const std::size_t max_threads = 1);
+
+std::vector<ConstLanelets> getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const std::vector<geometry_msgs::msg::Pose> & search_poses, const std::size_t max_threads = 1);
+
+/**
+ * [getClosestLanelets finds the closest lanelet of the map for each of the search poses. result[i]
+ * equals the lanelet found by getClosestLanelet for search_poses[i], or is empty if it found none]
+ * @param lanelet_map_ptr [lanelet map to search in]
+ * @param search_poses    [poses to search for, only x, y and yaw are used]
+ * @param max_threads     [number of threads to search with, 0 for the hardware concurrency]
+ * @return                [closest lanelet of each pose]
+ */
+std::vector<std::optional<ConstLanelet>> getClosestLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const std::vector<geometry_msgs::msg::Pose> & search_poses, const std::size_t max_threads = 1);
+
 /**
  * [getSucceedingLaneletSequences retrieves a sequence of lanelets after the given lanelet.
  * The total length of retrieved lanelet sequence at least given length. Returned lanelet sequence
@@ -347,6 +594,118 @@ std::vector<lanelet::ConstLanelets> getPrecedingLaneletSequences(
   const routing::RoutingGraphPtr & graph, const lanelet::ConstLanelet & lanelet,
   const double length, const lanelet::ConstLanelets & exclude_lanelets = {});
 
+/**
+ * [LaneletSequences stores lanelet sequences in one flat buffer. Sequence i consists of
+ * lanelets[offsets[i]] to lanelets[offsets[i + 1] - 1]]
+ */
+struct LaneletSequences
+{
+  std::vector<std::size_t> offsets{0};
+  lanelet::ConstLanelets lanelets;
+  bool truncated{false};  // true if sequences were left out because of max_sequences
+
+  std::size_t size() const { return offsets.size() - 1; }
+  bool empty() const { return size() == 0; }
+  lanelet::ConstLanelets::const_iterator begin(const std::size_t i) const
+  {
+    return lanelets.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+  }
+  lanelet::ConstLanelets::const_iterator end(const std::size_t i) const
+  {
+    return lanelets.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+  }
+  lanelet::ConstLanelets sequence(const std::size_t i) const { return {begin(i), end(i)}; }
+
+  /**
+   * [toVectors copies the sequences into the format of getSucceedingLaneletSequences]
+   */
+  std::vector<lanelet::ConstLanelets> toVectors() const;
+};
+
+/**
+ * [enumerateSucceedingLaneletSequences retrieves the same sequences as
+ * getSucceedingLaneletSequences in the same order. The graph is searched iteratively, the length
+ * of each lanelet is computed once and the sequences are written to one flat buffer]
+ * @param graph         [input lanelet routing graph]
+ * @param lanelet       [input lanelet]
+ * @param length        [minimum length of retrieved lanelet sequence]
+ * @param max_sequences [maximum number of sequences, the first ones in search order are kept]
+ * @return              [lanelet sequences that follow given lanelet]
+ */
+LaneletSequences enumerateSucceedingLaneletSequences(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length,
+  const std::size_t max_sequences = std::numeric_limits<std::size_t>::max());
+
+/**
+ * [enumerateSucceedingLaneletSequencesExcludingIds retrieves the sequences of lanelets following
+ * the given lanelet which do not pass through any of the excluded lanelets, e.g. for a loop-free
+ * lookahead along a route. Excluded lanelets are looked up by id in constant time]
+ * @param graph         [input lanelet routing graph]
+ * @param lanelet       [input lanelet]
+ * @param length        [minimum length of retrieved lanelet sequence]
+ * @param exclude_ids   [ids of the lanelets the sequences must not pass through]
+ * @param max_sequences [maximum number of sequences, the first ones in search order are kept]
+ * @return              [lanelet sequences that follow given lanelet]
+ */
+LaneletSequences enumerateSucceedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const std::size_t max_sequences = std::numeric_limits<std::size_t>::max());
+
+/**
+ * [enumerateSucceedingLaneletSequencesExcludingIds is the same as above, but takes the lengths of
+ * the lanelets from the cache]
+ * @param geometry_cache [geometry of the lanelets of the graph]
+ */
+LaneletSequences enumerateSucceedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const LaneletGeometryCache & geometry_cache,
+  const std::size_t max_sequences = std::numeric_limits<std::size_t>::max());
+
+/**
+ * [enumeratePrecedingLaneletSequences retrieves the same sequences as
+ * getPrecedingLaneletSequences in the same order, see enumerateSucceedingLaneletSequences]
+ * @param graph            [input lanelet routing graph]
+ * @param lanelet          [input lanelet]
+ * @param length           [minimum length of retrieved lanelet sequence]
+ * @param exclude_lanelets [lanelets the sequences must not pass through]
+ * @param max_sequences    [maximum number of sequences, the first ones in search order are kept]
+ * @return                 [lanelet sequences that lead to given lanelet]
+ */
+LaneletSequences enumeratePrecedingLaneletSequences(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const lanelet::ConstLanelets & exclude_lanelets = {},
+  const std::size_t max_sequences = std::numeric_limits<std::size_t>::max());
+
+/**
+ * [enumeratePrecedingLaneletSequencesExcludingIds is the same as
+ * enumeratePrecedingLaneletSequences, but takes the excluded lanelets as a set of ids so that
+ * callers passing e.g. a whole route do not convert it on every call]
+ * @param graph         [input lanelet routing graph]
+ * @param lanelet       [input lanelet]
+ * @param length        [minimum length of retrieved lanelet sequence]
+ * @param exclude_ids   [ids of the lanelets the sequences must not pass through]
+ * @param max_sequences [maximum number of sequences, the first ones in search order are kept]
+ * @return              [lanelet sequences that lead to given lanelet]
+ */
+LaneletSequences enumeratePrecedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const std::size_t max_sequences = std::numeric_limits<std::size_t>::max());
+
+/**
+ * [enumeratePrecedingLaneletSequencesExcludingIds is the same as above, but takes the lengths of
+ * the lanelets from the cache]
+ * @param geometry_cache [geometry of the lanelets of the graph]
+ */
+LaneletSequences enumeratePrecedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const LaneletGeometryCache & geometry_cache,
+  const std::size_t max_sequences = std::numeric_limits<std::size_t>::max());
+
 }  // namespace lanelet::utils::query
 
 // NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,96 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__REGULATORY_ELEMENT_INDEX_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__REGULATORY_ELEMENT_INDEX_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/bus_stop_area.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/crosswalk.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/detection_area.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/no_parking_area.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/no_stopping_area.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/road_marking.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/roundabout.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/speed_bump.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/virtual_traffic_light.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace lanelet::utils
+{
+/**
+ * [RegulatoryElementIndex maps the id of every lanelet of a map to its regulatory elements, cast
+ * once to each of lanelet::TrafficLight and the Autoware regulatory element types. It is built
+ * once per map load, so that per-cycle queries are hash lookups instead of dynamic casts. The
+ * index is a snapshot: regulatory elements added to the map later are not seen. It can be queried
+ * from several threads and copies share the same immutable index]
+ */
+class RegulatoryElementIndex
+{
+public:
+  RegulatoryElementIndex();
+  explicit RegulatoryElementIndex(const lanelet::LaneletMapConstPtr & lanelet_map_ptr);
+
+  /**
+   * [regulatoryElementsAs returns the regulatory elements of the lanelet of the given type, like
+   * lanelet.regulatoryElementsAs<RegulatoryElementT>() did when the index was built]
+   * @param lanelet [lanelet of the indexed map, lanelets of other maps have none]
+   * @return        [regulatory elements of type RegulatoryElementT]
+   */
+  template <typename RegulatoryElementT>
+  const std::vector<std::shared_ptr<const RegulatoryElementT>> & regulatoryElementsAs(
+    const lanelet::ConstLanelet & lanelet) const
+  {
+    static const std::vector<std::shared_ptr<const RegulatoryElementT>> none;
+    const auto it = lanelet_regulatory_elements_->find(lanelet.id());
+    if (it == lanelet_regulatory_elements_->end()) {
+      return none;
+    }
+    return std::get<std::vector<std::shared_ptr<const RegulatoryElementT>>>(it->second);
+  }
+
+  /**
+   * [size returns the number of lanelets with at least one regulatory element]
+   */
+  std::size_t size() const;
+
+  using RegulatoryElementsOfLanelet = std::tuple<
+    std::vector<lanelet::TrafficLightConstPtr>, std::vector<lanelet::AutowareTrafficLightConstPtr>,
+    std::vector<lanelet::BusStopAreaConstPtr>, std::vector<lanelet::CrosswalkConstPtr>,
+    std::vector<lanelet::DetectionAreaConstPtr>, std::vector<lanelet::NoParkingAreaConstPtr>,
+    std::vector<lanelet::NoStoppingAreaConstPtr>,
+    std::vector<std::shared_ptr<const lanelet::autoware::RoadMarking>>,
+    std::vector<std::shared_ptr<const lanelet::autoware::Roundabout>>,
+    std::vector<lanelet::SpeedBumpConstPtr>,
+    std::vector<std::shared_ptr<const lanelet::autoware::VirtualTrafficLight>>>;
+
+private:
+  std::shared_ptr<const std::unordered_map<lanelet::Id, RegulatoryElementsOfLanelet>>
+    lanelet_regulatory_elements_;
+};
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__REGULATORY_ELEMENT_INDEX_HPP_
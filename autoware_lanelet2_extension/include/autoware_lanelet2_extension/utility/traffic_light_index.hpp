@@ -0,0 +1,112 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__UTILITY__TRAFFIC_LIGHT_INDEX_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__UTILITY__TRAFFIC_LIGHT_INDEX_HPP_
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/regulatory_elements/Forward.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/primitives/LineString.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace lanelet::utils
+{
+/**
+ * [TrafficLightIndex relates the AutowareTrafficLight regulatory elements of a map to their traffic
+ * light linestrings, light bulbs, stop lines and controlled lanelets. Light bulbs refer to their
+ * traffic light linestring by the traffic_light_id attribute. It is built once per map load, so
+ * that resolving an id is a hash lookup instead of a scan over all traffic lights. It can be
+ * queried from several threads and copies share the same immutable index]
+ */
+class TrafficLightIndex
+{
+public:
+  TrafficLightIndex();
+  explicit TrafficLightIndex(const lanelet::LaneletMapConstPtr & lanelet_map_ptr);
+
+  /**
+   * [regulatoryElement finds a traffic light regulatory element by its id]
+   * @param regulatory_element_id [id of an AutowareTrafficLight]
+   * @return                      [the regulatory element, nullptr if there is none]
+   */
+  lanelet::AutowareTrafficLightConstPtr regulatoryElement(
+    const lanelet::Id regulatory_element_id) const;
+
+  /**
+   * [regulatoryElementsOfTrafficLight finds the regulatory elements referring to a traffic light
+   * linestring or polygon]
+   * @param traffic_light_id [id of the traffic light, as in the traffic_light_id of light bulbs]
+   * @return                 [regulatory elements in the order of the regulatory element layer]
+   */
+  const std::vector<lanelet::AutowareTrafficLightConstPtr> & regulatoryElementsOfTrafficLight(
+    const lanelet::Id traffic_light_id) const;
+
+  /**
+   * [regulatoryElementsOfLightBulbs finds the regulatory elements referring to light bulbs]
+   * @param light_bulbs_id [id of the light bulbs linestring]
+   * @return               [regulatory elements in the order of the regulatory element layer]
+   */
+  const std::vector<lanelet::AutowareTrafficLightConstPtr> & regulatoryElementsOfLightBulbs(
+    const lanelet::Id light_bulbs_id) const;
+
+  /**
+   * [lightBulbs finds the light bulbs of a traffic light by their traffic_light_id attribute]
+   * @param traffic_light_id [id of the traffic light linestring]
+   * @return                 [light bulbs linestrings]
+   */
+  const lanelet::ConstLineStrings3d & lightBulbs(const lanelet::Id traffic_light_id) const;
+
+  /**
+   * [trafficLightIdOfLightBulbs returns the traffic_light_id attribute of light bulbs]
+   * @param light_bulbs_id [id of the light bulbs linestring]
+   * @return               [traffic_light_id, nullopt for unknown or untagged light bulbs]
+   */
+  std::optional<lanelet::Id> trafficLightIdOfLightBulbs(const lanelet::Id light_bulbs_id) const;
+
+  /**
+   * [stopLine returns the stop line of a traffic light regulatory element]
+   * @param regulatory_element_id [id of an AutowareTrafficLight]
+   * @return                      [stop line, nullopt if it has none or the id is unknown]
+   */
+  std::optional<lanelet::ConstLineString3d> stopLine(const lanelet::Id regulatory_element_id) const;
+
+  /**
+   * [controlledLanelets returns the lanelets referring to a traffic light regulatory element]
+   * @param regulatory_element_id [id of an AutowareTrafficLight]
+   * @return                      [lanelets in the order of the lanelet layer]
+   */
+  const lanelet::ConstLanelets & controlledLanelets(const lanelet::Id regulatory_element_id) const;
+
+  /**
+   * [size returns the number of traffic light regulatory elements]
+   */
+  std::size_t size() const;
+
+private:
+  struct Impl;
+  std::shared_ptr<const Impl> impl_;
+};
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__UTILITY__TRAFFIC_LIGHT_INDEX_HPP_
@@ -19,6 +19,8 @@
 
 // NOLINTBEGIN(readability-identifier-naming)
 
+#include "autoware_lanelet2_extension/utility/lanelet_geometry_cache.hpp"
+
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 
@@ -26,6 +28,7 @@
 #include <lanelet2_core/primitives/Point.h>
 #include <lanelet2_routing/Forward.h>
 
+#include <cstddef>
 #include <map>
 
 namespace lanelet::utils
@@ -68,13 +71,24 @@ getExpandedLanelet(
     const lanelet::ConstLanelets & lanelet_obj, const double left_offset,
     const double right_offset);
 
+struct CenterlineOverwriteStats
+{
+  std::size_t lanelets{0};  // lanelets whose centerline was overwritten
+  std::size_t points{0};    // points of the new centerlines
+  double elapsed_ms{0.0};   // wall time of the whole map
+};
+
 /**
  * @brief  Apply a patch for centerline because the original implementation
- * doesn't have enough quality
+ * doesn't have enough quality. The centerlines are computed in parallel, their ids are the same
+ * as if generateFineCenterline was called for every lanelet in the order of the lanelet layer
+ * @param thread_count  number of threads to compute with, 0 for the hardware concurrency
+ * @param stats         if not null, set to the number of centerlines and the time taken
  */
 void overwriteLaneletsCenterline(
   lanelet::LaneletMapPtr lanelet_map, const double resolution = 5.0,
-  const bool force_overwrite = false);
+  const bool force_overwrite = false, const std::size_t thread_count = 0,
+  CenterlineOverwriteStats * stats = nullptr);
 
 /**
  * @brief  Apply another patch for centerline because the overwriteLaneletsCenterline
@@ -84,7 +98,31 @@ void overwriteLaneletsCenterline(
  */
 void overwriteLaneletsCenterlineWithWaypoints(
   lanelet::LaneletMapPtr lanelet_map, const double resolution = 5.0,
-  const bool force_overwrite = false);
+  const bool force_overwrite = false, const std::size_t thread_count = 0,
+  CenterlineOverwriteStats * stats = nullptr);
+
+struct MapWarmUpStats
+{
+  std::size_t lanelets{0};
+  double centerline_ms{0.0};      // wall time to compute the centerlines
+  double geometry_cache_ms{0.0};  // wall time to build the geometry cache, 0 if none was built
+};
+
+/**
+ * @brief  Compute the lazily generated geometry of every lanelet in parallel, so that the first
+ * queries after loading a map do not pay for it. Lanelet2 computes the centerline of a lanelet on
+ * its first use and keeps it, which also speeds up centerline2d(), length2d() and length3d().
+ * The polygons of lanelets are not kept by lanelet2, pass geometry_cache to keep them together
+ * with lengths and bounding boxes. Call it after the centerlines were overwritten, e.g. by
+ * overwriteLaneletsCenterline, and before the map is shared with other threads.
+ * @param lanelet_map    [map to warm up]
+ * @param thread_count   [number of threads to compute with, 0 for the hardware concurrency]
+ * @param geometry_cache [if not null, set to a LaneletGeometryCache of the map]
+ * @return               [number of lanelets and time taken]
+ */
+MapWarmUpStats warmUpMap(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const std::size_t thread_count = 0,
+  LaneletGeometryCache * geometry_cache = nullptr);
 
 [[deprecated(
   "please use autoware::lanelet2_utils::get_conflicting_lanelets instead")]] lanelet::ConstLanelets
@@ -109,6 +147,26 @@ bool lineStringToPolygon(
 [[deprecated("please use lanelet::geometry::length3d instead")]] double getLaneletLength3d(
   const lanelet::ConstLanelets & lanelet_sequence);
 
+/**
+ * [getLaneletLength2d sums the 2D lengths of the lanelet sequence, taking them from the cache
+ * where available]
+ * @param lanelet_sequence [input lanelet sequence]
+ * @param geometry_cache   [geometry of the map the lanelets belong to]
+ * @return                 [total 2D length]
+ */
+double getLaneletLength2d(
+  const lanelet::ConstLanelets & lanelet_sequence, const LaneletGeometryCache & geometry_cache);
+
+/**
+ * [getLaneletLength3d sums the 3D lengths of the lanelet sequence, taking them from the cache
+ * where available]
+ * @param lanelet_sequence [input lanelet sequence]
+ * @param geometry_cache   [geometry of the map the lanelets belong to]
+ * @return                 [total 3D length]
+ */
+double getLaneletLength3d(
+  const lanelet::ConstLanelets & lanelet_sequence, const LaneletGeometryCache & geometry_cache);
+
 [[deprecated(
   "please use autoware::lanelet2_utils::get_arc_coordinates instead")]] lanelet::ArcCoordinates
 getArcCoordinates(
@@ -146,6 +204,19 @@ getLaneletAngle(
   const geometry_msgs::msg::Pose & current_pose, const lanelet::ConstLanelet & lanelet,
   const double radius = 0.0);
 
+/**
+ * [isInLanelet checks whether the pose is at most radius away from the 2D polygon of the lanelet,
+ * taking the polygon from the cache where available]
+ * @param current_pose   [pose to check, only x and y are used]
+ * @param lanelet        [input lanelet]
+ * @param geometry_cache [geometry of the map the lanelet belongs to]
+ * @param radius         [maximum distance]
+ * @return               [whether the pose is in the lanelet]
+ */
+bool isInLanelet(
+  const geometry_msgs::msg::Pose & current_pose, const lanelet::ConstLanelet & lanelet,
+  const LaneletGeometryCache & geometry_cache, const double radius = 0.0);
+
 [[deprecated(
   "please use autoware::lanelet2_utils::get_closest_center_pose instead")]] geometry_msgs::msg::Pose
 getClosestCenterPose(
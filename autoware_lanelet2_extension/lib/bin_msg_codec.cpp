@@ -0,0 +1,398 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "bin_msg_codec.hpp"
+
+#include "autoware_lanelet2_extension/io/flat_map.hpp"
+#include "bin_msg_stream.hpp"
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_io/io_handlers/Serialize.h>
+#include <lz4.h>
+#include <zstd.h>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils::conversion::impl
+{
+namespace
+{
+constexpr std::uint8_t bin_msg_magic[4] = {'A', 'W', 'L', 'B'};
+constexpr int zstd_compression_level = 3;
+/// LZ4 encodes at most 255 bytes of a match or literal run per input byte
+constexpr std::uint64_t lz4_max_expansion = 255;
+
+void serializeMap(
+  const lanelet::LaneletMap & map, const RoutingGraphSection * routing_graph,
+  std::vector<std::uint8_t> * data)
+{
+  ByteVectorOutputBuffer buffer(*data);
+  boost::archive::binary_oarchive oa(buffer);
+  oa << map;
+  auto id_counter = lanelet::utils::getId();
+  oa << id_counter;
+  if (routing_graph != nullptr) {
+    saveRoutingGraphSection(oa, *routing_graph);
+  }
+}
+
+lanelet::Id deserializeMap(
+  const std::uint8_t * data, const std::size_t size, const bool has_routing_graph,
+  lanelet::LaneletMap * map, std::optional<RoutingGraphSection> * routing_graph)
+{
+  ByteArrayInputBuffer buffer(data, size);
+  boost::archive::binary_iarchive ia(buffer);
+  ia >> *map;
+  lanelet::Id id_counter = 0;
+  ia >> id_counter;
+  if (has_routing_graph && routing_graph != nullptr) {
+    RoutingGraphSection section;
+    loadRoutingGraphSection(ia, &section);
+    *routing_graph = std::move(section);
+  }
+  return id_counter;
+}
+
+lanelet::Id materializeFlatMap(
+  const std::uint8_t * data, const std::size_t size, const std::uint32_t layers,
+  lanelet::LaneletMap * map)
+{
+  // the records are read in place and need their natural alignment
+  std::vector<std::uint8_t> aligned;
+  if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint64_t) != 0) {  // NOLINT
+    aligned.assign(data, data + size);
+    data = aligned.data();
+  }
+  const lanelet::io_handlers::FlatMapView view(data, size);
+  *map = std::move(*lanelet::io_handlers::materialize(view, layers));
+  return view.idCounter();
+}
+
+void compressLZ4(
+  const std::vector<std::uint8_t> & raw, const std::size_t offset, std::vector<std::uint8_t> * data)
+{
+  if (raw.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE)) {
+    throw std::runtime_error("map is too large to be compressed with LZ4");
+  }
+  const auto raw_size = static_cast<int>(raw.size());
+  const int bound = LZ4_compressBound(raw_size);
+  data->resize(offset + static_cast<std::size_t>(bound));
+  const auto * src = reinterpret_cast<const char *>(raw.data());  // NOLINT
+  auto * dst = reinterpret_cast<char *>(data->data() + offset);     // NOLINT
+  const int compressed_size = LZ4_compress_default(src, dst, raw_size, bound);
+  if (compressed_size <= 0) {
+    throw std::runtime_error("failed to compress map with LZ4");
+  }
+  data->resize(offset + static_cast<std::size_t>(compressed_size));
+}
+
+void decompressLZ4(
+  const std::uint8_t * src, const std::size_t src_size, std::vector<std::uint8_t> * raw)
+{
+  if (
+    src_size > static_cast<std::size_t>(std::numeric_limits<int>::max()) ||
+    raw->size() > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    throw std::runtime_error("LZ4 payload is too large");
+  }
+  const auto * src_chars = reinterpret_cast<const char *>(src);  // NOLINT
+  auto * dst_chars = reinterpret_cast<char *>(raw->data());        // NOLINT
+  const int decompressed_size = LZ4_decompress_safe(
+    src_chars, dst_chars, static_cast<int>(src_size), static_cast<int>(raw->size()));
+  if (decompressed_size < 0 || static_cast<std::size_t>(decompressed_size) != raw->size()) {
+    throw std::runtime_error("failed to decompress LZ4 map payload");
+  }
+}
+
+void compressZstd(
+  const std::vector<std::uint8_t> & raw, const std::size_t offset, std::vector<std::uint8_t> * data)
+{
+  const std::size_t bound = ZSTD_compressBound(raw.size());
+  data->resize(offset + bound);
+  const std::size_t compressed_size = ZSTD_compress(
+    data->data() + offset, bound, raw.data(), raw.size(), zstd_compression_level);
+  if (ZSTD_isError(compressed_size)) {
+    throw std::runtime_error(
+      std::string("failed to compress map with zstd: ") + ZSTD_getErrorName(compressed_size));
+  }
+  data->resize(offset + compressed_size);
+}
+
+/// rejects a decoded size the body cannot expand to, before it is allocated
+void checkRawSize(
+  const BinMsgHeader & header, const std::uint8_t * body, const std::size_t body_size)
+{
+  switch (header.compression) {
+    case BinMsgCompression::LZ4:
+      if (header.raw_size > static_cast<std::uint64_t>(body_size) * lz4_max_expansion) {
+        throw std::runtime_error(
+          "LaneletMapBin header claims " + std::to_string(header.raw_size) +
+          " bytes for an LZ4 body of " + std::to_string(body_size) + " bytes");
+      }
+      break;
+    case BinMsgCompression::Zstd: {
+      // ZSTD_compress records the decoded size in the frame
+      const auto frame_size = ZSTD_getFrameContentSize(body, body_size);
+      if (
+        frame_size == ZSTD_CONTENTSIZE_ERROR || frame_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+        frame_size != header.raw_size) {
+        throw std::runtime_error(
+          "LaneletMapBin header claims " + std::to_string(header.raw_size) +
+          " bytes, which does not match the zstd frame");
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void decompressZstd(
+  const std::uint8_t * src, const std::size_t src_size, std::vector<std::uint8_t> * raw)
+{
+  const std::size_t decompressed_size = ZSTD_decompress(raw->data(), raw->size(), src, src_size);
+  if (ZSTD_isError(decompressed_size) || decompressed_size != raw->size()) {
+    throw std::runtime_error("failed to decompress zstd map payload");
+  }
+}
+}  // namespace
+
+bool hasBinMsgHeader(const std::uint8_t * data, const std::size_t size)
+{
+  return size >= bin_msg_header_v1_size &&
+         std::memcmp(data, bin_msg_magic, sizeof(bin_msg_magic)) == 0;
+}
+
+BinMsgHeader readBinMsgHeader(const std::uint8_t * data, const std::size_t size)
+{
+  if (!hasBinMsgHeader(data, size)) {
+    throw std::runtime_error("LaneletMapBin payload has no header");
+  }
+
+  BinMsgHeader header;
+  header.version = data[4];
+  if (header.version == 0 || header.version > bin_msg_header_version) {
+    throw std::runtime_error(
+      "unsupported LaneletMapBin header version " + std::to_string(header.version));
+  }
+  if (size < header.size()) {
+    throw std::runtime_error("LaneletMapBin header is truncated");
+  }
+  header.compression = static_cast<BinMsgCompression>(data[5]);
+  header.flags = static_cast<std::uint16_t>(data[6] | (data[7] << 8));
+  header.raw_size = 0;
+  for (std::size_t i = 0; i < 8; ++i) {
+    header.raw_size |= static_cast<std::uint64_t>(data[8 + i]) << (8 * i);
+  }
+  if (header.version >= 2) {
+    for (std::size_t i = 0; i < 8; ++i) {
+      header.fingerprint |= static_cast<std::uint64_t>(data[16 + i]) << (8 * i);
+    }
+  }
+  return header;
+}
+
+void writeBinMsgHeader(const BinMsgHeader & header, std::uint8_t * data)
+{
+  std::memcpy(data, bin_msg_magic, sizeof(bin_msg_magic));
+  data[4] = header.version;
+  data[5] = static_cast<std::uint8_t>(header.compression);
+  data[6] = static_cast<std::uint8_t>(header.flags & 0xFF);
+  data[7] = static_cast<std::uint8_t>(header.flags >> 8);
+  for (std::size_t i = 0; i < 8; ++i) {
+    data[8 + i] = static_cast<std::uint8_t>((header.raw_size >> (8 * i)) & 0xFF);
+  }
+  for (std::size_t i = 0; i < 8; ++i) {
+    data[16 + i] = static_cast<std::uint8_t>((header.fingerprint >> (8 * i)) & 0xFF);
+  }
+}
+
+std::size_t estimateBinSize(const lanelet::LaneletMap & map)
+{
+  // rough lower bounds of the per-primitive cost in the boost binary archive without attributes:
+  // one regrowth is cheaper than reserving memory that is never written
+  constexpr std::size_t archive_header_size = 64;
+  constexpr std::size_t point_size = 56;
+  constexpr std::size_t point_reference_size = 12;
+  constexpr std::size_t linestring_size = 48;
+  constexpr std::size_t polygon_size = 48;
+  constexpr std::size_t lanelet_size = 96;
+  constexpr std::size_t area_size = 96;
+  constexpr std::size_t regulatory_element_size = 128;
+
+  std::size_t point_references = 0;
+  for (const auto & ls : map.lineStringLayer) {
+    point_references += ls.size();
+  }
+  for (const auto & poly : map.polygonLayer) {
+    point_references += poly.size();
+  }
+
+  return archive_header_size + map.pointLayer.size() * point_size +
+         point_references * point_reference_size + map.lineStringLayer.size() * linestring_size +
+         map.polygonLayer.size() * polygon_size + map.laneletLayer.size() * lanelet_size +
+         map.areaLayer.size() * area_size +
+         map.regulatoryElementLayer.size() * regulatory_element_size;
+}
+
+void writeMapPayload(
+  const lanelet::LaneletMap & map, const BinMsgCompression compression,
+  std::vector<std::uint8_t> * data, const RoutingGraphSection * routing_graph,
+  const BinMsgFormat format)
+{
+  data->clear();
+
+  const bool flat_layout = format == BinMsgFormat::Flat;
+  if (flat_layout && routing_graph != nullptr) {
+    throw std::invalid_argument("a routing graph can only be embedded in the boost layout");
+  }
+
+  if (format == BinMsgFormat::Legacy) {
+    // for subscribers built before the header existed, which read a bare boost archive
+    if (compression != BinMsgCompression::None || routing_graph != nullptr) {
+      throw std::invalid_argument("the legacy layout can be neither compressed nor carry a graph");
+    }
+    data->reserve(estimateBinSize(map));
+    serializeMap(map, nullptr, data);
+    return;
+  }
+
+  BinMsgHeader header;
+  header.compression = compression;
+  header.fingerprint = computeFingerprint(map);
+  if (routing_graph != nullptr) {
+    header.flags |= BinMsgFlag::RoutingGraph;
+  }
+  if (flat_layout) {
+    header.flags |= BinMsgFlag::FlatLayout;
+  }
+
+  if (compression == BinMsgCompression::None && !flat_layout) {
+    data->reserve(bin_msg_header_size + estimateBinSize(map));
+    data->resize(bin_msg_header_size);
+    serializeMap(map, routing_graph, data);
+    header.raw_size = data->size() - bin_msg_header_size;
+    writeBinMsgHeader(header, data->data());
+    return;
+  }
+
+  std::vector<std::uint8_t> raw;
+  if (flat_layout) {
+    lanelet::io_handlers::writeFlatMap(map, &raw);
+  } else {
+    raw.reserve(estimateBinSize(map));
+    serializeMap(map, routing_graph, &raw);
+  }
+  writeEncodedPayload(raw, header, data);
+}
+
+void writeEncodedPayload(
+  const std::vector<std::uint8_t> & raw, BinMsgHeader header, std::vector<std::uint8_t> * data)
+{
+  data->clear();
+  header.raw_size = raw.size();
+
+  switch (header.compression) {
+    case BinMsgCompression::None:
+      data->reserve(bin_msg_header_size + raw.size());
+      data->resize(bin_msg_header_size);
+      data->insert(data->end(), raw.begin(), raw.end());
+      break;
+    case BinMsgCompression::LZ4:
+      compressLZ4(raw, bin_msg_header_size, data);
+      break;
+    case BinMsgCompression::Zstd:
+      compressZstd(raw, bin_msg_header_size, data);
+      break;
+    default:
+      throw std::invalid_argument("unknown LaneletMapBin compression");
+  }
+  writeBinMsgHeader(header, data->data());
+}
+
+std::vector<std::uint8_t> readEncodedPayload(
+  const std::vector<std::uint8_t> & data, BinMsgHeader * header)
+{
+  *header = readBinMsgHeader(data.data(), data.size());
+  const auto * body = data.data() + header->size();
+  const auto body_size = data.size() - header->size();
+
+  if (header->compression == BinMsgCompression::None) {
+    return {body, body + body_size};
+  }
+
+  checkRawSize(*header, body, body_size);
+  std::vector<std::uint8_t> raw(header->raw_size);
+  switch (header->compression) {
+    case BinMsgCompression::LZ4:
+      decompressLZ4(body, body_size, &raw);
+      break;
+    case BinMsgCompression::Zstd:
+      decompressZstd(body, body_size, &raw);
+      break;
+    default:
+      throw std::runtime_error(
+        "unknown LaneletMapBin compression " +
+        std::to_string(static_cast<int>(header->compression)));
+  }
+  return raw;
+}
+
+lanelet::Id readMapPayload(
+  const std::vector<std::uint8_t> & data, lanelet::LaneletMap * map,
+  std::optional<RoutingGraphSection> * routing_graph, const std::uint32_t layers)
+{
+  if (routing_graph != nullptr) {
+    routing_graph->reset();
+  }
+  if (!hasBinMsgHeader(data.data(), data.size())) {
+    return deserializeMap(data.data(), data.size(), false, map, routing_graph);
+  }
+
+  const auto header = readBinMsgHeader(data.data(), data.size());
+  const auto * body = data.data() + header.size();
+  const auto body_size = data.size() - header.size();
+  const bool has_routing_graph = (header.flags & BinMsgFlag::RoutingGraph) != 0;
+  const bool flat_layout = (header.flags & BinMsgFlag::FlatLayout) != 0;
+  if ((header.flags & BinMsgFlag::Patch) != 0) {
+    throw std::runtime_error("LaneletMapBin payload is a map patch, use applyPatchMsg");
+  }
+
+  const auto decode = [&](const std::uint8_t * bytes, const std::size_t size) {
+    if (flat_layout) {
+      return materializeFlatMap(bytes, size, layers, map);
+    }
+    return deserializeMap(bytes, size, has_routing_graph, map, routing_graph);
+  };
+
+  if (header.compression == BinMsgCompression::None) {
+    return decode(body, body_size);
+  }
+
+  BinMsgHeader encoded_header;
+  const auto raw = readEncodedPayload(data, &encoded_header);
+  return decode(raw.data(), raw.size());
+}
+}  // namespace lanelet::utils::conversion::impl
+
+// NOLINTEND(readability-identifier-naming)
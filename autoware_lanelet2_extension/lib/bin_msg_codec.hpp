@@ -0,0 +1,153 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_CODEC_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_CODEC_HPP_
+
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+#include "bin_msg_routing_graph.hpp"
+
+#include <lanelet2_core/Forward.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace lanelet::utils::conversion::impl
+{
+/**
+ * Layout of LaneletMapBin::data
+ *
+ * legacy (BinMsgFormat::Legacy, and every payload written before the header existed):
+ *   boost binary archive of the map followed by the id counter
+ *
+ * with header (any other format):
+ *   offset  size  field
+ *   0       4     magic "AWLB"
+ *   4       1     header version
+ *   5       1     BinMsgCompression
+ *   6       2     flags (BinMsgFlag, little endian)
+ *   8       8     size of the decoded boost archive (little endian)
+ *   16      8     content fingerprint of the map, 0 if unknown (little endian, version >= 2)
+ *   24      -     encoded boost archive (offset 16 for version 1)
+ *
+ * With BinMsgFlag::RoutingGraph the boost archive continues with a RoutingGraphSection after the
+ * id counter. With BinMsgFlag::FlatLayout the body is a flat map (io/flat_map.hpp) instead of a
+ * boost archive, which allows decoding only some layers. With BinMsgFlag::Patch the body is a
+ * MapPatch (utility/map_patch.hpp) instead of a map.
+ *
+ * A boost binary archive starts with the length of its signature string (0x16), so it can never
+ * be mistaken for the magic.
+ */
+constexpr std::size_t bin_msg_header_size = 24;
+constexpr std::size_t bin_msg_header_v1_size = 16;
+constexpr std::uint8_t bin_msg_header_version = 2;
+
+namespace BinMsgFlag
+{
+constexpr std::uint16_t RoutingGraph = 1U << 0U;
+constexpr std::uint16_t FlatLayout = 1U << 1U;
+constexpr std::uint16_t Patch = 1U << 2U;
+}  // namespace BinMsgFlag
+
+struct BinMsgHeader
+{
+  std::uint8_t version{bin_msg_header_version};
+  BinMsgCompression compression{BinMsgCompression::None};
+  std::uint16_t flags{0};
+  std::uint64_t raw_size{0};
+  std::uint64_t fingerprint{0};
+
+  /// offset of the body in the payload
+  std::size_t size() const
+  {
+    return version == 1 ? bin_msg_header_v1_size : bin_msg_header_size;
+  }
+};
+
+/**
+ * [hasBinMsgHeader checks whether the payload starts with the "AWLB" header]
+ */
+bool hasBinMsgHeader(const std::uint8_t * data, const std::size_t size);
+
+/**
+ * [readBinMsgHeader parses the header of a payload. Version 1 headers are read with a zero
+ * fingerprint. throws std::runtime_error on a malformed header]
+ */
+BinMsgHeader readBinMsgHeader(const std::uint8_t * data, const std::size_t size);
+
+/**
+ * [writeBinMsgHeader writes the header into the first bin_msg_header_size bytes of data]
+ */
+void writeBinMsgHeader(const BinMsgHeader & header, std::uint8_t * data);
+
+/**
+ * [estimateBinSize estimates the size of the boost binary archive of a map from its layer sizes]
+ */
+std::size_t estimateBinSize(const lanelet::LaneletMap & map);
+
+/**
+ * [writeMapPayload serializes the map and the current id counter into data]
+ * @param map           [map to serialize]
+ * @param compression   [encoding of the payload]
+ * @param data          [output payload, overwritten]
+ * @param routing_graph [optional routing graph to embed after the map, boost layout only]
+ * @param format        [layout of the decoded payload]
+ */
+void writeMapPayload(
+  const lanelet::LaneletMap & map, const BinMsgCompression compression,
+  std::vector<std::uint8_t> * data, const RoutingGraphSection * routing_graph = nullptr,
+  const BinMsgFormat format = BinMsgFormat::Boost);
+
+/**
+ * [writeEncodedPayload writes the header followed by the compressed body]
+ * @param raw    [serialized body]
+ * @param header [compression, flags and fingerprint of the payload; raw_size is filled in]
+ * @param data   [output payload, overwritten]
+ */
+void writeEncodedPayload(
+  const std::vector<std::uint8_t> & raw, BinMsgHeader header, std::vector<std::uint8_t> * data);
+
+/**
+ * [readEncodedPayload decompresses the body of a payload with header. throws on malformed
+ * payloads]
+ * @param data   [payload]
+ * @param header [parsed header]
+ * @return       [serialized body]
+ */
+std::vector<std::uint8_t> readEncodedPayload(
+  const std::vector<std::uint8_t> & data, BinMsgHeader * header);
+
+/**
+ * [readMapPayload deserializes a payload written by writeMapPayload or by the legacy toBinMsg.
+ * throws on malformed payloads]
+ * @param data          [payload]
+ * @param map           [deserialized map]
+ * @param routing_graph [if not null, set to the embedded routing graph when there is one]
+ * @param layers        [BinMsgLayer mask of the layers to fill. Only honored by the flat layout,
+ *                       boost archives are always decoded completely]
+ * @return              [id counter stored in the payload]
+ */
+lanelet::Id readMapPayload(
+  const std::vector<std::uint8_t> & data, lanelet::LaneletMap * map,
+  std::optional<RoutingGraphSection> * routing_graph = nullptr,
+  const std::uint32_t layers = BinMsgLayer::All);
+}  // namespace lanelet::utils::conversion::impl
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_CODEC_HPP_
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,404 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "bin_msg_routing_graph.hpp"
+
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+#include "fingerprint_hasher.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/geometry/Area.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_routing/RoutingCost.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_routing/internal/Graph.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils::conversion::impl
+{
+namespace
+{
+class SectionBuilder
+{
+public:
+  SectionBuilder(const lanelet::routing::RoutingGraph & graph, RoutingGraphSection * section)
+  : graph_(graph), section_(section)
+  {
+  }
+
+  void addVertex(const lanelet::Id id)
+  {
+    vertex_index_.emplace(id, static_cast<std::uint32_t>(vertex_index_.size()));
+  }
+
+  void addEdge(
+    const lanelet::ConstLaneletOrArea & from, const lanelet::ConstLaneletOrArea & to,
+    const lanelet::routing::RelationType relation)
+  {
+    const auto from_it = vertex_index_.find(from.id());
+    const auto to_it = vertex_index_.find(to.id());
+    if (from_it == vertex_index_.end() || to_it == vertex_index_.end()) {
+      return;
+    }
+    if (!captured_.emplace(from_it->second, to_it->second).second) {
+      return;
+    }
+    const auto cost = graph_.getEdgeCost(from, to);
+    if (!cost) {
+      return;
+    }
+    RoutingGraphSection::Edge edge;
+    edge.from = from_it->second;
+    edge.to = to_it->second;
+    edge.routing_cost = *cost;
+    edge.relation = static_cast<std::uint8_t>(relation);
+    section_->edges.push_back(edge);
+  }
+
+private:
+  const lanelet::routing::RoutingGraph & graph_;
+  RoutingGraphSection * section_;
+  std::unordered_map<lanelet::Id, std::uint32_t> vertex_index_;
+  std::set<std::pair<std::uint32_t, std::uint32_t>> captured_;
+};
+
+/// distinguishes the answers of the traffic rules for different queries
+enum class RulesTag : std::uint8_t {
+  Lanelet = 1,
+  LaneChange,
+  Successor,
+  Area,
+};
+
+/// hashes what the routing graph builder asks the traffic rules. Summed like computeFingerprint, so
+/// the iteration order of the layers does not matter
+std::uint64_t hashTrafficRules(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules)
+{
+  std::uint64_t sum = 0;
+  for (const auto & lanelet : map.laneletLayer) {
+    FingerprintHasher hasher(static_cast<std::uint8_t>(RulesTag::Lanelet));
+    hasher.add(lanelet.id());
+    hasher.add(traffic_rules.canPass(lanelet));
+    hasher.add(traffic_rules.canPass(lanelet.invert()));
+    hasher.add(traffic_rules.isOneWay(lanelet));
+    const auto speed_limit = traffic_rules.speedLimit(lanelet);
+    hasher.add(speed_limit.speedLimit.value());
+    hasher.add(speed_limit.isMandatory);
+    sum += mixFingerprint(hasher.value());
+
+    // lane changes to the lanelets sharing a bound
+    for (const auto & bound : {lanelet.leftBound(), lanelet.rightBound()}) {
+      for (const auto & other : map.laneletLayer.findUsages(bound)) {
+        if (other.id() == lanelet.id()) {
+          continue;
+        }
+        FingerprintHasher pair_hasher(static_cast<std::uint8_t>(RulesTag::LaneChange));
+        pair_hasher.add(lanelet.id());
+        pair_hasher.add(other.id());
+        pair_hasher.add(traffic_rules.canChangeLane(lanelet, other));
+        sum += mixFingerprint(pair_hasher.value());
+      }
+    }
+
+    // successors start where the left bound ends
+    std::set<lanelet::Id> successors;
+    for (const auto & line_string : map.lineStringLayer.findUsages(lanelet.leftBound().back())) {
+      for (const auto & other : map.laneletLayer.findUsages(line_string)) {
+        if (
+          other.id() == lanelet.id() || !lanelet::geometry::follows(lanelet, other) ||
+          !successors.insert(other.id()).second) {
+          continue;
+        }
+        FingerprintHasher pair_hasher(static_cast<std::uint8_t>(RulesTag::Successor));
+        pair_hasher.add(lanelet.id());
+        pair_hasher.add(other.id());
+        pair_hasher.add(traffic_rules.canPass(lanelet, other));
+        sum += mixFingerprint(pair_hasher.value());
+      }
+    }
+  }
+  for (const auto & area : map.areaLayer) {
+    FingerprintHasher hasher(static_cast<std::uint8_t>(RulesTag::Area));
+    hasher.add(area.id());
+    hasher.add(traffic_rules.canPass(area));
+    sum += mixFingerprint(hasher.value());
+  }
+  return sum;
+}
+
+bool sameCost(const double a, const double b)
+{
+  // infinite costs mark impossible lane changes
+  return a == b || std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+/// the cost routing_cost gives to a routable edge, std::nullopt for relations without own cost
+std::optional<double> expectedCost(
+  const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCost & routing_cost, const lanelet::ConstLaneletOrArea & from,
+  const lanelet::ConstLaneletOrArea & to, const lanelet::routing::RelationType relation)
+{
+  using lanelet::routing::RelationType;
+  switch (relation) {
+    case RelationType::Successor:
+    case RelationType::Area:
+      return routing_cost.getCostSucceeding(traffic_rules, from, to);
+    case RelationType::Left:
+    case RelationType::Right:
+      if (!from.isLanelet() || !to.isLanelet()) {
+        return std::nullopt;
+      }
+      return routing_cost.getCostLaneChange(
+        traffic_rules, lanelet::ConstLanelets{*from.lanelet()},
+        lanelet::ConstLanelets{*to.lanelet()});
+    default:
+      return std::nullopt;
+  }
+}
+}  // namespace
+
+RoutingGraphFingerprint makeRoutingGraphFingerprint(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const std::uint64_t map_fingerprint)
+{
+  RoutingGraphFingerprint fingerprint;
+  fingerprint.location = traffic_rules.location();
+  fingerprint.participant = traffic_rules.participant();
+  fingerprint.map_fingerprint = map_fingerprint != 0 ? map_fingerprint : computeFingerprint(map);
+  fingerprint.rules_fingerprint = hashTrafficRules(map, traffic_rules);
+  return fingerprint;
+}
+
+RoutingGraphSection captureRoutingGraph(
+  const lanelet::LaneletMap & map, const lanelet::routing::RoutingGraph & graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules)
+{
+  RoutingGraphSection section;
+  // only routing cost id 0 is captured, subscribers compute the others
+  section.fingerprint = makeRoutingGraphFingerprint(map, traffic_rules);
+
+  const auto submap = graph.passableSubmap();
+  SectionBuilder builder(graph, &section);
+  section.lanelet_ids.reserve(submap->laneletLayer.size());
+  for (const auto & lanelet : submap->laneletLayer) {
+    section.lanelet_ids.push_back(lanelet.id());
+    builder.addVertex(lanelet.id());
+  }
+  section.area_ids.reserve(submap->areaLayer.size());
+  for (const auto & area : submap->areaLayer) {
+    section.area_ids.push_back(area.id());
+    builder.addVertex(area.id());
+  }
+
+  using lanelet::routing::RelationType;
+  for (const auto & lanelet : submap->laneletLayer) {
+    for (const auto & relation : graph.followingRelations(lanelet, true)) {
+      builder.addEdge(lanelet, relation.lanelet, relation.relationType);
+    }
+    if (const auto left = graph.adjacentLeft(lanelet)) {
+      builder.addEdge(lanelet, *left, RelationType::AdjacentLeft);
+    }
+    if (const auto right = graph.adjacentRight(lanelet)) {
+      builder.addEdge(lanelet, *right, RelationType::AdjacentRight);
+    }
+    for (const auto & conflicting : graph.conflicting(lanelet)) {
+      builder.addEdge(lanelet, conflicting, RelationType::Conflicting);
+    }
+  }
+
+  // the graph has no query for the area relation, so probe every primitive touching an area
+  for (const auto & area : submap->areaLayer) {
+    for (const auto & conflicting : graph.conflicting(area)) {
+      builder.addEdge(area, conflicting, RelationType::Conflicting);
+    }
+    const auto bbox = lanelet::geometry::boundingBox2d(area);
+    for (const auto & lanelet : submap->laneletLayer.search(bbox)) {
+      builder.addEdge(area, lanelet, RelationType::Area);
+      builder.addEdge(lanelet, area, RelationType::Area);
+    }
+    for (const auto & other : submap->areaLayer.search(bbox)) {
+      if (other.id() != area.id()) {
+        builder.addEdge(area, other, RelationType::Area);
+      }
+    }
+  }
+
+  return section;
+}
+
+lanelet::routing::RoutingGraphPtr restoreRoutingGraph(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCostPtrs & routing_costs, const RoutingGraphSection & section)
+{
+  if (routing_costs.empty()) {
+    throw std::runtime_error("routing graph needs at least one routing cost");
+  }
+  lanelet::ConstLanelets lanelets;
+  lanelets.reserve(section.lanelet_ids.size());
+  for (const auto id : section.lanelet_ids) {
+    if (!map.laneletLayer.exists(id)) {
+      throw std::runtime_error("routing graph refers to missing lanelet " + std::to_string(id));
+    }
+    lanelets.push_back(map.laneletLayer.get(id));
+  }
+  lanelet::ConstAreas areas;
+  areas.reserve(section.area_ids.size());
+  for (const auto id : section.area_ids) {
+    if (!map.areaLayer.exists(id)) {
+      throw std::runtime_error("routing graph refers to missing area " + std::to_string(id));
+    }
+    areas.push_back(map.areaLayer.get(id));
+  }
+
+  std::vector<lanelet::ConstLaneletOrArea> vertices;
+  vertices.reserve(lanelets.size() + areas.size());
+  vertices.insert(vertices.end(), lanelets.begin(), lanelets.end());
+  vertices.insert(vertices.end(), areas.begin(), areas.end());
+
+  auto graph = std::make_unique<lanelet::routing::internal::RoutingGraphGraph>(
+    static_cast<lanelet::routing::RoutingCostId>(routing_costs.size()));
+  for (const auto & vertex : vertices) {
+    graph->addVertex(lanelet::routing::internal::VertexInfo{vertex});
+  }
+  for (const auto & edge : section.edges) {
+    if (edge.from >= vertices.size() || edge.to >= vertices.size()) {
+      throw std::runtime_error("routing graph edge refers to an unknown vertex");
+    }
+    const auto & from = vertices[edge.from];
+    const auto & to = vertices[edge.to];
+    const auto relation = static_cast<lanelet::routing::RelationType>(edge.relation);
+    const auto expected = expectedCost(traffic_rules, *routing_costs.front(), from, to, relation);
+    if (expected && !sameCost(*expected, edge.routing_cost)) {
+      throw std::runtime_error("routing graph was built with other routing costs");
+    }
+    lanelet::routing::internal::EdgeInfo info{};
+    info.routingCost = edge.routing_cost;
+    info.costId = 0;
+    info.relation = relation;
+    graph->addEdge(from, to, info);
+    if (!expected) {
+      // relations without a cost, e.g. conflicting, are stored once
+      continue;
+    }
+    // only routing cost id 0 is embedded, the builder adds one edge per routing cost
+    for (std::size_t cost_id = 1; cost_id < routing_costs.size(); ++cost_id) {
+      info.routingCost = *expectedCost(traffic_rules, *routing_costs[cost_id], from, to, relation);
+      info.costId = static_cast<lanelet::routing::RoutingCostId>(cost_id);
+      graph->addEdge(from, to, info);
+    }
+  }
+
+  lanelet::LaneletSubmapConstPtr passable_map = lanelet::utils::createConstSubmap(lanelets, areas);
+  return std::make_shared<lanelet::routing::RoutingGraph>(
+    std::move(graph), std::move(passable_map));
+}
+
+lanelet::routing::RoutingGraphPtr restoreOrBuildRoutingGraph(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCostPtrs & routing_costs,
+  const std::optional<RoutingGraphSection> & section, const std::uint64_t map_fingerprint)
+{
+  // hashing the traffic rules asks them much of what building the graph does, so it is skipped
+  // when the cheap parts of the fingerprint differ already
+  const auto matches = [&]() {
+    const auto & expected = section->fingerprint;
+    if (
+      expected.format_version != routing_graph_format_version ||
+      expected.location != traffic_rules.location() ||
+      expected.participant != traffic_rules.participant()) {
+      return false;
+    }
+    const auto actual = map_fingerprint != 0 ? map_fingerprint : computeFingerprint(map);
+    return expected.map_fingerprint == actual &&
+           expected.rules_fingerprint == hashTrafficRules(map, traffic_rules);
+  };
+  if (section && !routing_costs.empty() && matches()) {
+    try {
+      return restoreRoutingGraph(map, traffic_rules, routing_costs, *section);
+    } catch (const std::runtime_error & e) {
+      std::cerr << __FUNCTION__ << ": cannot restore embedded routing graph, rebuilding: "
+                << e.what() << std::endl;
+    }
+  }
+  return lanelet::routing::RoutingGraph::build(map, traffic_rules, routing_costs);
+}
+
+void saveRoutingGraphSection(boost::archive::binary_oarchive & oa, const RoutingGraphSection & s)
+{
+  oa << s.fingerprint.format_version << s.fingerprint.location << s.fingerprint.participant
+     << s.fingerprint.map_fingerprint << s.fingerprint.rules_fingerprint;
+
+  const std::uint64_t lanelet_count = s.lanelet_ids.size();
+  oa << lanelet_count;
+  for (const auto id : s.lanelet_ids) {
+    oa << id;
+  }
+  const std::uint64_t area_count = s.area_ids.size();
+  oa << area_count;
+  for (const auto id : s.area_ids) {
+    oa << id;
+  }
+  const std::uint64_t edge_count = s.edges.size();
+  oa << edge_count;
+  for (const auto & edge : s.edges) {
+    oa << edge.from << edge.to << edge.routing_cost << edge.relation;
+  }
+}
+
+void loadRoutingGraphSection(boost::archive::binary_iarchive & ia, RoutingGraphSection * s)
+{
+  ia >> s->fingerprint.format_version;
+  if (s->fingerprint.format_version != routing_graph_format_version) {
+    // a section written by a newer or older encoder cannot be parsed; leave it to the caller to
+    // rebuild the graph from the map
+    return;
+  }
+  ia >> s->fingerprint.location >> s->fingerprint.participant >> s->fingerprint.map_fingerprint >>
+    s->fingerprint.rules_fingerprint;
+
+  std::uint64_t lanelet_count = 0;
+  ia >> lanelet_count;
+  s->lanelet_ids.resize(lanelet_count);
+  for (auto & id : s->lanelet_ids) {
+    ia >> id;
+  }
+  std::uint64_t area_count = 0;
+  ia >> area_count;
+  s->area_ids.resize(area_count);
+  for (auto & id : s->area_ids) {
+    ia >> id;
+  }
+  std::uint64_t edge_count = 0;
+  ia >> edge_count;
+  s->edges.resize(edge_count);
+  for (auto & edge : s->edges) {
+    ia >> edge.from >> edge.to >> edge.routing_cost >> edge.relation;
+  }
+}
+}  // namespace lanelet::utils::conversion::impl
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,146 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_ROUTING_GRAPH_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_ROUTING_GRAPH_HPP_
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_routing/Forward.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace lanelet::utils::conversion::impl
+{
+/**
+ * Version of the embedded routing graph section. Bump it whenever the section layout or the way
+ * edges are captured changes, so that graphs written by older encoders are rebuilt.
+ */
+constexpr std::uint32_t routing_graph_format_version = 3;
+
+/**
+ * [RoutingGraphFingerprint identifies what an embedded routing graph was built for. A graph is only
+ * restored when the fingerprint matches the map and traffic rules of the subscriber. The routing
+ * costs are checked edge by edge while restoring]
+ */
+struct RoutingGraphFingerprint
+{
+  std::uint32_t format_version{routing_graph_format_version};
+  std::string location;
+  std::string participant;
+  std::uint64_t map_fingerprint{0};    // computeFingerprint of the map
+  std::uint64_t rules_fingerprint{0};  // what the traffic rules answer for the map
+
+  bool operator==(const RoutingGraphFingerprint & other) const
+  {
+    return format_version == other.format_version && location == other.location &&
+           participant == other.participant && map_fingerprint == other.map_fingerprint &&
+           rules_fingerprint == other.rules_fingerprint;
+  }
+  bool operator!=(const RoutingGraphFingerprint & other) const { return !(*this == other); }
+};
+
+/**
+ * [RoutingGraphSection is the plain-data form of a routing graph stored in LaneletMapBin. Vertices
+ * are the passable lanelets followed by the passable areas; edges refer to them by index]
+ */
+struct RoutingGraphSection
+{
+  struct Edge
+  {
+    std::uint32_t from{0};
+    std::uint32_t to{0};
+    double routing_cost{0.0};
+    std::uint8_t relation{0};
+  };
+
+  RoutingGraphFingerprint fingerprint;
+  std::vector<lanelet::Id> lanelet_ids;
+  std::vector<lanelet::Id> area_ids;
+  std::vector<Edge> edges;
+};
+
+/**
+ * [makeRoutingGraphFingerprint computes the fingerprint of a map for the given traffic rules. The
+ * rules are fingerprinted by their answers for the lanelets and areas of the map (passability,
+ * one-way, speed limits, lane changes and successors), so rules with the same name but other
+ * parameters give another fingerprint]
+ * @param map             [map the graph is built on]
+ * @param traffic_rules   [traffic rules the graph is built with]
+ * @param map_fingerprint [computeFingerprint of map if known, e.g. from the payload header, 0 to
+ *                         compute it]
+ */
+RoutingGraphFingerprint makeRoutingGraphFingerprint(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const std::uint64_t map_fingerprint = 0);
+
+/**
+ * [captureRoutingGraph converts a routing graph into its plain-data form. Only routing cost id 0,
+ * which the Autoware planning modules query, is captured]
+ * @param map           [map the graph was built on]
+ * @param graph         [routing graph to capture]
+ * @param traffic_rules [traffic rules the graph was built with]
+ */
+RoutingGraphSection captureRoutingGraph(
+  const lanelet::LaneletMap & map, const lanelet::routing::RoutingGraph & graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules);
+
+/**
+ * [restoreRoutingGraph rebuilds a routing graph from its plain-data form without recomputing
+ * relations. The embedded costs of the routable edges are checked against the first routing cost,
+ * and the costs of the other routing cost ids are computed for these edges with the same queries
+ * RoutingGraph::build makes. Both are cheap next to finding the relations.
+ * throws std::runtime_error if the section refers to primitives missing in the map, if its costs
+ * differ from the first routing cost or if routing_costs is empty]
+ * @param map           [deserialized map]
+ * @param traffic_rules [traffic rules of the subscriber]
+ * @param routing_costs [routing costs of the subscriber, the first one is routing cost id 0]
+ * @param section       [routing graph read from the payload]
+ */
+lanelet::routing::RoutingGraphPtr restoreRoutingGraph(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCostPtrs & routing_costs, const RoutingGraphSection & section);
+
+/**
+ * [restoreOrBuildRoutingGraph restores the embedded routing graph if it was built for this map,
+ * these traffic rules and the first of these routing costs, and builds a new one otherwise. The
+ * traffic rules are only hashed once the participant, location and map match]
+ * @param map             [deserialized map]
+ * @param traffic_rules   [traffic rules of the subscriber]
+ * @param routing_costs   [routing costs of the subscriber]
+ * @param section         [routing graph read from the payload, if any]
+ * @param map_fingerprint [fingerprint from the payload header, 0 to compute it from map]
+ */
+lanelet::routing::RoutingGraphPtr restoreOrBuildRoutingGraph(
+  const lanelet::LaneletMap & map, const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  const lanelet::routing::RoutingCostPtrs & routing_costs,
+  const std::optional<RoutingGraphSection> & section, const std::uint64_t map_fingerprint = 0);
+
+void saveRoutingGraphSection(boost::archive::binary_oarchive & oa, const RoutingGraphSection & s);
+void loadRoutingGraphSection(boost::archive::binary_iarchive & ia, RoutingGraphSection * s);
+}  // namespace lanelet::utils::conversion::impl
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_ROUTING_GRAPH_HPP_
+
+// NOLINTEND(readability-identifier-naming)
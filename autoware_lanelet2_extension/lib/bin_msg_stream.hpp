@@ -0,0 +1,107 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_STREAM_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_STREAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <streambuf>
+#include <vector>
+
+namespace lanelet::utils::conversion::impl
+{
+/**
+ * @brief read-only std::streambuf over an existing byte array (e.g. LaneletMapBin::data).
+ * boost archives can be constructed directly from a streambuf, so the payload is parsed in place
+ * instead of being copied into a std::string and a std::stringstream first.
+ * The underlying array must outlive this buffer.
+ */
+class ByteArrayInputBuffer : public std::streambuf
+{
+public:
+  ByteArrayInputBuffer(const std::uint8_t * data, const std::size_t size)
+  {
+    // the get area is never written through, so dropping const here is safe
+    auto * begin = const_cast<char *>(reinterpret_cast<const char *>(data));  // NOLINT
+    setg(begin, begin, begin + size);
+  }
+
+protected:
+  pos_type seekoff(
+    off_type off, std::ios_base::seekdir dir,
+    std::ios_base::openmode which = std::ios_base::in) override
+  {
+    if (!(which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+    char * target = nullptr;
+    if (dir == std::ios_base::beg) {
+      target = eback() + off;
+    } else if (dir == std::ios_base::cur) {
+      target = gptr() + off;
+    } else {
+      target = egptr() + off;
+    }
+    if (target < eback() || target > egptr()) {
+      return pos_type(off_type(-1));
+    }
+    setg(eback(), target, egptr());
+    return pos_type(target - eback());
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override
+  {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+
+/**
+ * @brief write-only std::streambuf appending to a byte vector (e.g. LaneletMapBin::data).
+ * boost archives write through sputn(), so the serialized map goes straight into the message
+ * instead of a std::stringstream whose contents are copied twice afterwards.
+ * Reserve the vector beforehand to avoid regrowth.
+ */
+class ByteVectorOutputBuffer : public std::streambuf
+{
+public:
+  explicit ByteVectorOutputBuffer(std::vector<std::uint8_t> & data) : data_(data) {}
+
+protected:
+  int_type overflow(int_type ch) override
+  {
+    if (traits_type::eq_int_type(ch, traits_type::eof())) {
+      return traits_type::not_eof(ch);
+    }
+    data_.push_back(static_cast<std::uint8_t>(traits_type::to_char_type(ch)));
+    return ch;
+  }
+
+  std::streamsize xsputn(const char * s, std::streamsize n) override
+  {
+    const auto * begin = reinterpret_cast<const std::uint8_t *>(s);  // NOLINT
+    data_.insert(data_.end(), begin, begin + n);
+    return n;
+  }
+
+private:
+  std::vector<std::uint8_t> & data_;
+};
+}  // namespace lanelet::utils::conversion::impl
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__LIB__BIN_MSG_STREAM_HPP_
+
+// NOLINTEND(readability-identifier-naming)
@@ -195,15 +195,23 @@ double getLaneletAngle(
     segment.back().y() - segment.front().y(), segment.back().x() - segment.front().x());
 }
 
+bool isLaneletWithinRange(
+  const lanelet::ConstLanelet & lanelet, const lanelet::BasicPoint2d & search_point,
+  const double range)
+{
+  if (boost::geometry::distance(lanelet::geometry::boundingBox2d(lanelet), search_point) > range) {
+    return false;
+  }
+  return lanelet::geometry::distance(lanelet.polygon2d().basicPolygon(), search_point) <= range;
+}
+
 lanelet::ConstLanelets getLaneletsWithinRange(
   const lanelet::ConstLanelets & lanelets, const lanelet::BasicPoint2d & search_point,
   const double range)
 {
   lanelet::ConstLanelets near_lanelets;
   for (const auto & ll : lanelets) {
-    lanelet::BasicPolygon2d poly = ll.polygon2d().basicPolygon();
-    double distance = lanelet::geometry::distance(poly, search_point);
-    if (distance <= range) {
+    if (isLaneletWithinRange(ll, search_point, range)) {
       near_lanelets.push_back(ll);
     }
   }
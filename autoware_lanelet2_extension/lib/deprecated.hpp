@@ -49,6 +49,11 @@ lanelet::ConstLineString3d getClosestSegment(
 double getLaneletAngle(
   const lanelet::ConstLanelet & lanelet, const geometry_msgs::msg::Point & search_point);
 
+// checks the bounding box first, it is never farther than the polygon and much cheaper to get
+bool isLaneletWithinRange(
+  const lanelet::ConstLanelet & lanelet, const lanelet::BasicPoint2d & search_point,
+  const double range);
+
 lanelet::ConstLanelets getLaneletsWithinRange(
   const lanelet::ConstLanelets & lanelets, const lanelet::BasicPoint2d & search_point,
   const double range);
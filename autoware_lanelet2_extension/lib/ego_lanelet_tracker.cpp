@@ -0,0 +1,160 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/ego_lanelet_tracker.hpp"
+
+#include "./deprecated.hpp"
+#include "autoware_lanelet2_extension/utility/query.hpp"
+
+#include <tf2/utils.hpp>
+
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_routing/RoutingGraph.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace lanelet::utils
+{
+EgoLaneletTracker::EgoLaneletTracker(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const lanelet::routing::RoutingGraphConstPtr & routing_graph, const double dist_threshold,
+  const double yaw_threshold)
+: EgoLaneletTracker(
+    LaneletSubsetIndex(query::roadLanelets(query::laneletLayer(lanelet_map_ptr))), routing_graph,
+    dist_threshold, yaw_threshold)
+{
+}
+
+EgoLaneletTracker::EgoLaneletTracker(
+  const LaneletSubsetIndex & index, const lanelet::routing::RoutingGraphConstPtr & routing_graph,
+  const double dist_threshold, const double yaw_threshold)
+: index_(index),
+  routing_graph_(routing_graph),
+  dist_threshold_(dist_threshold),
+  yaw_threshold_(yaw_threshold)
+{
+  tracked_ids_.reserve(index_.size());
+  for (const auto & llt : index_.lanelets()) {
+    tracked_ids_.insert(llt.id());
+  }
+}
+
+bool EgoLaneletTracker::update(
+  const geometry_msgs::msg::Pose & pose, lanelet::ConstLanelet * lanelet_ptr)
+{
+  if (lanelet_ptr == nullptr) {
+    std::cerr << __FUNCTION__ << ": lanelet_ptr is null pointer!" << std::endl;
+    return false;
+  }
+
+  last_update_was_local_ = current_lanelet_ && updateLocally(pose, lanelet_ptr);
+  if (last_update_was_local_) {
+    current_lanelet_ = *lanelet_ptr;
+    return true;
+  }
+
+  if (!query::getClosestLaneletWithConstrains(
+        index_, pose, lanelet_ptr, dist_threshold_, yaw_threshold_)) {
+    current_lanelet_.reset();
+    return false;
+  }
+  current_lanelet_ = *lanelet_ptr;
+  return true;
+}
+
+void EgoLaneletTracker::setCurrentLanelet(const lanelet::ConstLanelet & lanelet)
+{
+  current_lanelet_ = lanelet;
+}
+
+std::optional<lanelet::ConstLanelet> EgoLaneletTracker::currentLanelet() const
+{
+  return current_lanelet_;
+}
+
+void EgoLaneletTracker::reset()
+{
+  current_lanelet_.reset();
+  last_update_was_local_ = false;
+}
+
+bool EgoLaneletTracker::lastUpdateWasLocal() const
+{
+  return last_update_was_local_;
+}
+
+bool EgoLaneletTracker::updateLocally(
+  const geometry_msgs::msg::Pose & pose, lanelet::ConstLanelet * lanelet_ptr) const
+{
+  lanelet::ConstLanelets candidates{*current_lanelet_};
+  addNeighborhood(*current_lanelet_, &candidates);
+
+  // the pose is inside the found lanelet, so it is at distance 0 like the closest lanelets of the
+  // global search, and the direction decides between overlapping ones
+  const lanelet::BasicPoint2d search_point(pose.position.x, pose.position.y);
+  const double pose_yaw = tf2::getYaw(pose.orientation);
+  double min_angle = std::numeric_limits<double>::max();
+  bool found = false;
+  for (const auto & llt : candidates) {
+    if (tracked_ids_.count(llt.id()) == 0 || !lanelet::geometry::inside(llt, search_point)) {
+      continue;
+    }
+    const double lanelet_angle = deprecated::getLaneletAngle(llt, pose.position);
+    const double angle_diff = std::abs(deprecated::normalize_radian(lanelet_angle - pose_yaw));
+    if (angle_diff > std::abs(yaw_threshold_)) {
+      continue;
+    }
+    if (angle_diff < min_angle) {
+      min_angle = angle_diff;
+      *lanelet_ptr = llt;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void EgoLaneletTracker::addNeighborhood(
+  const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * candidates) const
+{
+  if (!routing_graph_) {
+    return;
+  }
+
+  const auto following = routing_graph_->following(lanelet);
+  candidates->insert(candidates->end(), following.begin(), following.end());
+  const auto previous = routing_graph_->previous(lanelet);
+  candidates->insert(candidates->end(), previous.begin(), previous.end());
+
+  auto left_lane = routing_graph_->left(lanelet) ? routing_graph_->left(lanelet)
+                                                 : routing_graph_->adjacentLeft(lanelet);
+  while (left_lane) {
+    candidates->push_back(*left_lane);
+    left_lane = routing_graph_->left(*left_lane) ? routing_graph_->left(*left_lane)
+                                                 : routing_graph_->adjacentLeft(*left_lane);
+  }
+  auto right_lane = routing_graph_->right(lanelet) ? routing_graph_->right(lanelet)
+                                                   : routing_graph_->adjacentRight(lanelet);
+  while (right_lane) {
+    candidates->push_back(*right_lane);
+    right_lane = routing_graph_->right(*right_lane) ? routing_graph_->right(*right_lane)
+                                                    : routing_graph_->adjacentRight(*right_lane);
+  }
+}
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,83 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__LIB__FINGERPRINT_HASHER_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__LIB__FINGERPRINT_HASHER_HPP_
+
+#include <lanelet2_core/Forward.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace lanelet::utils::conversion::impl
+{
+/// 64 bit FNV-1a, which unlike std::hash gives the same value on every platform and toolchain
+class FingerprintHasher
+{
+public:
+  explicit FingerprintHasher(const std::uint8_t tag) { add(tag); }
+
+  void add(const void * data, const std::size_t size)
+  {
+    const auto * bytes = static_cast<const std::uint8_t *>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+      value_ = (value_ ^ bytes[i]) * fnv_prime;
+    }
+  }
+  void add(const std::uint8_t value) { add(&value, sizeof(value)); }
+  void add(const bool value) { add(static_cast<std::uint8_t>(value ? 1U : 0U)); }
+  void add(const lanelet::Id value) { add(&value, sizeof(value)); }
+  void add(const std::uint64_t value) { add(&value, sizeof(value)); }
+  void add(double value)
+  {
+    if (value == 0.0) {
+      value = 0.0;  // -0.0 and 0.0 describe the same position
+    }
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    add(bits);
+  }
+  void add(const std::string & value)
+  {
+    add(static_cast<std::uint64_t>(value.size()));
+    add(value.data(), value.size());
+  }
+
+  std::uint64_t value() const { return value_; }
+
+private:
+  static constexpr std::uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+  static constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+  std::uint64_t value_{fnv_offset_basis};
+};
+
+/// splitmix64 finalizer, spreads per-primitive hashes before they are summed
+inline std::uint64_t mixFingerprint(std::uint64_t value)
+{
+  value ^= value >> 30U;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27U;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31U;
+  return value;
+}
+}  // namespace lanelet::utils::conversion::impl
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__LIB__FINGERPRINT_HASHER_HPP_
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,1081 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/io/flat_map.hpp"
+
+#include "parallel.hpp"
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <lanelet2_core/Exceptions.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/geometry/Area.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/primitives/RegulatoryElement.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::io_handlers
+{
+namespace
+{
+static_assert(std::is_trivially_copyable_v<flat::Header>);
+static_assert(std::is_trivially_copyable_v<flat::Lanelet>);
+static_assert(sizeof(flat::Header) % 8 == 0);
+
+constexpr std::size_t section_alignment = 8;
+
+flat::Box toBox(const lanelet::BoundingBox2d & box)
+{
+  return {box.min().x(), box.min().y(), box.max().x(), box.max().y()};
+}
+
+template <typename T>
+const T & at(const flat::Span<T> & span, const std::size_t i)
+{
+  if (i >= span.size()) {
+    throw std::runtime_error("flat map refers to a record out of range");
+  }
+  return span[i];
+}
+
+template <typename Record>
+std::optional<std::uint32_t> findById(const flat::Span<Record> & records, const lanelet::Id id)
+{
+  const auto it = std::lower_bound(
+    records.begin(), records.end(), id,
+    [](const Record & record, const lanelet::Id value) { return record.id < value; });
+  if (it == records.end() || it->id != id) {
+    return std::nullopt;
+  }
+  return static_cast<std::uint32_t>(it - records.begin());
+}
+
+/**
+ * Collects every primitive of a map, including the ones that are only reachable through other
+ * primitives, and assigns them their index in the sorted record arrays.
+ */
+template <typename T>
+class PrimitiveTable
+{
+public:
+  /// returns false if the primitive was already known
+  bool add(const lanelet::Id id, const T & primitive, const bool in_layer)
+  {
+    const auto [it, inserted] = entries_.try_emplace(id, primitive, in_layer);
+    it->second.second = it->second.second || in_layer;
+    return inserted;
+  }
+
+  void finalize()
+  {
+    ids_.reserve(entries_.size());
+    for (const auto & entry : entries_) {
+      ids_.push_back(entry.first);
+    }
+    std::sort(ids_.begin(), ids_.end());
+    index_.reserve(ids_.size());
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+      index_.emplace(ids_[i], static_cast<std::uint32_t>(i));
+    }
+  }
+
+  const std::vector<lanelet::Id> & ids() const { return ids_; }
+  const T & get(const lanelet::Id id) const { return entries_.at(id).first; }
+  bool inLayer(const lanelet::Id id) const { return entries_.at(id).second; }
+  std::uint32_t index(const lanelet::Id id) const { return index_.at(id); }
+
+private:
+  std::unordered_map<lanelet::Id, std::pair<T, bool>> entries_;
+  std::vector<lanelet::Id> ids_;
+  std::unordered_map<lanelet::Id, std::uint32_t> index_;
+};
+
+class StringTable
+{
+public:
+  std::uint32_t intern(const std::string & value)
+  {
+    const auto it = index_.find(value);
+    if (it != index_.end()) {
+      return it->second;
+    }
+    const auto index = static_cast<std::uint32_t>(offsets_.size());
+    offsets_.push_back(
+      {static_cast<std::uint32_t>(data_.size()), static_cast<std::uint32_t>(value.size())});
+    data_.insert(data_.end(), value.begin(), value.end());
+    index_.emplace(value, index);
+    return index;
+  }
+
+  const std::vector<flat::StringOffset> & offsets() const { return offsets_; }
+  const std::vector<char> & data() const { return data_; }
+
+private:
+  std::unordered_map<std::string, std::uint32_t> index_;
+  std::vector<flat::StringOffset> offsets_;
+  std::vector<char> data_;
+};
+
+class FlatMapWriter
+{
+public:
+  explicit FlatMapWriter(const lanelet::LaneletMap & map)
+  {
+    for (const auto & point : map.pointLayer) {
+      points_.add(point.id(), point, true);
+    }
+    for (const auto & line_string : map.lineStringLayer) {
+      addLineString(line_string, true);
+    }
+    for (const auto & polygon : map.polygonLayer) {
+      addPolygon(polygon, true);
+    }
+    for (const auto & lanelet : map.laneletLayer) {
+      addLanelet(lanelet, true);
+    }
+    for (const auto & area : map.areaLayer) {
+      addArea(area, true);
+    }
+    for (const auto & regulatory_element : map.regulatoryElementLayer) {
+      addRegulatoryElement(regulatory_element, true);
+    }
+
+    points_.finalize();
+    line_strings_.finalize();
+    polygons_.finalize();
+    lanelets_.finalize();
+    areas_.finalize();
+    regulatory_elements_.finalize();
+  }
+
+  void write(std::vector<std::uint8_t> * data)
+  {
+    std::vector<flat::Point> points;
+    points.reserve(points_.ids().size());
+    for (const auto id : points_.ids()) {
+      const auto & point = points_.get(id);
+      points.push_back(
+        {id, point.x(), point.y(), point.z(), addAttributes(point.attributes()), flags(points_, id),
+         0});
+    }
+
+    std::vector<flat::LineString> line_strings;
+    line_strings.reserve(line_strings_.ids().size());
+    for (const auto id : line_strings_.ids()) {
+      const auto & line_string = line_strings_.get(id);
+      line_strings.push_back(
+        {id, addPointRefs(line_string), addAttributes(line_string.attributes()),
+         flags(line_strings_, id), 0});
+    }
+
+    std::vector<flat::LineString> polygons;
+    polygons.reserve(polygons_.ids().size());
+    for (const auto id : polygons_.ids()) {
+      const auto & polygon = polygons_.get(id);
+      polygons.push_back(
+        {id, addPointRefs(polygon), addAttributes(polygon.attributes()), flags(polygons_, id), 0});
+    }
+
+    std::vector<flat::Lanelet> lanelets;
+    lanelets.reserve(lanelets_.ids().size());
+    for (const auto id : lanelets_.ids()) {
+      const auto & lanelet = lanelets_.get(id);
+      flat::Lanelet record{};
+      record.id = id;
+      record.left = boundRef(lanelet.leftBound());
+      record.right = boundRef(lanelet.rightBound());
+      record.centerline = lanelet.hasCustomCenterline()
+                            ? line_strings_.index(lanelet.centerline().id())
+                            : flat::invalid_index;
+      record.flags = flags(lanelets_, id);
+      record.bbox = toBox(lanelet::geometry::boundingBox2d(lanelet));
+      record.attributes = addAttributes(lanelet.attributes());
+      record.regulatory_elements = addRegulatoryElementRefs(lanelet.regulatoryElements());
+      lanelets.push_back(record);
+    }
+
+    std::vector<flat::Area> areas;
+    areas.reserve(areas_.ids().size());
+    for (const auto id : areas_.ids()) {
+      const auto & area = areas_.get(id);
+      flat::Area record{};
+      record.id = id;
+      record.outer_ring = addRing(area.outerBound());
+      record.flags = flags(areas_, id);
+      // rings of one area must be contiguous, so the outer ring goes first
+      record.inner_rings.begin = static_cast<std::uint32_t>(rings_.size());
+      for (const auto & inner : area.innerBounds()) {
+        addRing(inner);
+      }
+      record.inner_rings.count =
+        static_cast<std::uint32_t>(rings_.size()) - record.inner_rings.begin;
+      record.bbox = toBox(lanelet::geometry::boundingBox2d(area));
+      record.attributes = addAttributes(area.attributes());
+      record.regulatory_elements = addRegulatoryElementRefs(area.regulatoryElements());
+      areas.push_back(record);
+    }
+
+    std::vector<flat::RegulatoryElement> regulatory_elements;
+    regulatory_elements.reserve(regulatory_elements_.ids().size());
+    for (const auto id : regulatory_elements_.ids()) {
+      const auto & regulatory_element = regulatory_elements_.get(id);
+      flat::RegulatoryElement record{};
+      record.id = id;
+      record.attributes = addAttributes(regulatory_element->attributes());
+      record.parameters = addParameters(*regulatory_element);
+      record.flags = flags(regulatory_elements_, id);
+      regulatory_elements.push_back(record);
+    }
+
+    data->clear();
+    data->resize(sizeof(flat::Header));
+    flat::Header header{};
+    std::memcpy(header.magic, flat::magic, sizeof(header.magic));
+    header.version = flat::format_version;
+    header.endianness = flat::endianness_marker;
+    header.id_counter = lanelet::utils::getId();
+    header.section_count = flat::section_count;
+
+    appendSection(flat::Section::Points, points, &header, data);
+    appendSection(flat::Section::LineStrings, line_strings, &header, data);
+    appendSection(flat::Section::Polygons, polygons, &header, data);
+    appendSection(flat::Section::Lanelets, lanelets, &header, data);
+    appendSection(flat::Section::Areas, areas, &header, data);
+    appendSection(flat::Section::RegulatoryElements, regulatory_elements, &header, data);
+    appendSection(flat::Section::PointRefs, point_refs_, &header, data);
+    appendSection(flat::Section::BoundRefs, bound_refs_, &header, data);
+    appendSection(flat::Section::Rings, rings_, &header, data);
+    appendSection(flat::Section::RegulatoryElementRefs, regulatory_element_refs_, &header, data);
+    appendSection(flat::Section::Parameters, parameters_, &header, data);
+    appendSection(flat::Section::Attributes, attributes_, &header, data);
+    appendSection(flat::Section::StringOffsets, strings_.offsets(), &header, data);
+    appendSection(flat::Section::StringData, strings_.data(), &header, data);
+
+    std::memcpy(data->data(), &header, sizeof(header));
+  }
+
+private:
+  class ParameterCollector : public boost::static_visitor<void>
+  {
+  public:
+    explicit ParameterCollector(FlatMapWriter * writer) : writer_(writer) {}
+
+    void operator()(const lanelet::ConstPoint3d & point) const
+    {
+      writer_->points_.add(point.id(), point, false);
+    }
+    void operator()(const lanelet::ConstLineString3d & line_string) const
+    {
+      writer_->addLineString(line_string, false);
+    }
+    void operator()(const lanelet::ConstPolygon3d & polygon) const
+    {
+      writer_->addPolygon(polygon, false);
+    }
+    void operator()(const lanelet::ConstWeakLanelet & lanelet) const
+    {
+      if (!lanelet.expired()) {
+        writer_->addLanelet(lanelet.lock(), false);
+      }
+    }
+    void operator()(const lanelet::ConstWeakArea & area) const
+    {
+      if (!area.expired()) {
+        writer_->addArea(area.lock(), false);
+      }
+    }
+
+  private:
+    FlatMapWriter * writer_;
+  };
+
+  class ParameterEncoder : public boost::static_visitor<void>
+  {
+  public:
+    ParameterEncoder(FlatMapWriter * writer, const std::uint32_t role)
+    : writer_(writer), role_(role)
+    {
+    }
+
+    void operator()(const lanelet::ConstPoint3d & point) const
+    {
+      push(flat::ParameterKind::Point, writer_->points_.index(point.id()), false);
+    }
+    void operator()(const lanelet::ConstLineString3d & line_string) const
+    {
+      push(
+        flat::ParameterKind::LineString, writer_->line_strings_.index(line_string.id()),
+        line_string.inverted());
+    }
+    void operator()(const lanelet::ConstPolygon3d & polygon) const
+    {
+      push(
+        flat::ParameterKind::Polygon, writer_->polygons_.index(polygon.id()), polygon.inverted());
+    }
+    void operator()(const lanelet::ConstWeakLanelet & lanelet) const
+    {
+      if (!lanelet.expired()) {
+        push(flat::ParameterKind::Lanelet, writer_->lanelets_.index(lanelet.lock().id()), false);
+      }
+    }
+    void operator()(const lanelet::ConstWeakArea & area) const
+    {
+      if (!area.expired()) {
+        push(flat::ParameterKind::Area, writer_->areas_.index(area.lock().id()), false);
+      }
+    }
+
+  private:
+    void push(const flat::ParameterKind kind, const std::uint32_t index, const bool inverted) const
+    {
+      writer_->parameters_.push_back({role_, kind, index, inverted ? 1U : 0U});
+    }
+
+    FlatMapWriter * writer_;
+    std::uint32_t role_;
+  };
+
+  template <typename T>
+  static std::uint32_t flags(const PrimitiveTable<T> & table, const lanelet::Id id)
+  {
+    return table.inLayer(id) ? flat::flag_in_layer : 0U;
+  }
+
+  void addLineString(const lanelet::ConstLineString3d & line_string, const bool in_layer)
+  {
+    // store the data in its original direction, users keep their own inverted flag
+    const auto base = line_string.inverted() ? line_string.invert() : line_string;
+    if (!line_strings_.add(base.id(), base, in_layer)) {
+      return;
+    }
+    for (const auto & point : base) {
+      points_.add(point.id(), point, false);
+    }
+  }
+
+  void addPolygon(const lanelet::ConstPolygon3d & polygon, const bool in_layer)
+  {
+    const auto base = polygon.inverted() ? polygon.invert() : polygon;
+    if (!polygons_.add(base.id(), base, in_layer)) {
+      return;
+    }
+    for (const auto & point : base) {
+      points_.add(point.id(), point, false);
+    }
+  }
+
+  void addLanelet(const lanelet::ConstLanelet & lanelet, const bool in_layer)
+  {
+    if (!lanelets_.add(lanelet.id(), lanelet, in_layer)) {
+      return;
+    }
+    addLineString(lanelet.leftBound(), false);
+    addLineString(lanelet.rightBound(), false);
+    if (lanelet.hasCustomCenterline()) {
+      addLineString(lanelet.centerline(), false);
+    }
+    for (const auto & regulatory_element : lanelet.regulatoryElements()) {
+      addRegulatoryElement(regulatory_element, false);
+    }
+  }
+
+  void addArea(const lanelet::ConstArea & area, const bool in_layer)
+  {
+    if (!areas_.add(area.id(), area, in_layer)) {
+      return;
+    }
+    for (const auto & bound : area.outerBound()) {
+      addLineString(bound, false);
+    }
+    for (const auto & inner : area.innerBounds()) {
+      for (const auto & bound : inner) {
+        addLineString(bound, false);
+      }
+    }
+    for (const auto & regulatory_element : area.regulatoryElements()) {
+      addRegulatoryElement(regulatory_element, false);
+    }
+  }
+
+  void addRegulatoryElement(
+    const lanelet::RegulatoryElementConstPtr & regulatory_element, const bool in_layer)
+  {
+    if (!regulatory_elements_.add(regulatory_element->id(), regulatory_element, in_layer)) {
+      return;
+    }
+    const ParameterCollector collector(this);
+    for (const auto & role_parameters : regulatory_element->getParameters()) {
+      for (const auto & parameter : role_parameters.second) {
+        boost::apply_visitor(collector, parameter);
+      }
+    }
+  }
+
+  flat::Range addAttributes(const lanelet::AttributeMap & attributes)
+  {
+    flat::Range range{static_cast<std::uint32_t>(attributes_.size()), 0};
+    for (const auto & attribute : attributes) {
+      attributes_.push_back(
+        {strings_.intern(attribute.first), strings_.intern(attribute.second.value())});
+    }
+    range.count = static_cast<std::uint32_t>(attributes_.size()) - range.begin;
+    return range;
+  }
+
+  template <typename LineStringT>
+  flat::Range addPointRefs(const LineStringT & line_string)
+  {
+    flat::Range range{static_cast<std::uint32_t>(point_refs_.size()), 0};
+    for (const auto & point : line_string) {
+      point_refs_.push_back(points_.index(point.id()));
+    }
+    range.count = static_cast<std::uint32_t>(point_refs_.size()) - range.begin;
+    return range;
+  }
+
+  flat::BoundRef boundRef(const lanelet::ConstLineString3d & line_string) const
+  {
+    return {line_strings_.index(line_string.id()), line_string.inverted() ? 1U : 0U};
+  }
+
+  std::uint32_t addRing(const lanelet::ConstLineStrings3d & bounds)
+  {
+    flat::Ring ring{{static_cast<std::uint32_t>(bound_refs_.size()), 0}};
+    for (const auto & bound : bounds) {
+      bound_refs_.push_back(boundRef(bound));
+    }
+    ring.bounds.count = static_cast<std::uint32_t>(bound_refs_.size()) - ring.bounds.begin;
+    rings_.push_back(ring);
+    return static_cast<std::uint32_t>(rings_.size() - 1);
+  }
+
+  flat::Range addRegulatoryElementRefs(
+    const lanelet::RegulatoryElementConstPtrs & regulatory_elements)
+  {
+    flat::Range range{static_cast<std::uint32_t>(regulatory_element_refs_.size()), 0};
+    for (const auto & regulatory_element : regulatory_elements) {
+      regulatory_element_refs_.push_back(regulatory_elements_.index(regulatory_element->id()));
+    }
+    range.count = static_cast<std::uint32_t>(regulatory_element_refs_.size()) - range.begin;
+    return range;
+  }
+
+  flat::Range addParameters(const lanelet::RegulatoryElement & regulatory_element)
+  {
+    flat::Range range{static_cast<std::uint32_t>(parameters_.size()), 0};
+    for (const auto & role_parameters : regulatory_element.getParameters()) {
+      const ParameterEncoder encoder(this, strings_.intern(role_parameters.first));
+      for (const auto & parameter : role_parameters.second) {
+        boost::apply_visitor(encoder, parameter);
+      }
+    }
+    range.count = static_cast<std::uint32_t>(parameters_.size()) - range.begin;
+    return range;
+  }
+
+  template <typename T>
+  static void appendSection(
+    const flat::Section section, const std::vector<T> & records, flat::Header * header,
+    std::vector<std::uint8_t> * data)
+  {
+    const auto padding = (section_alignment - data->size() % section_alignment) % section_alignment;
+    data->resize(data->size() + padding);
+    auto & entry = header->sections[static_cast<std::size_t>(section)];
+    entry.offset = data->size();
+    entry.count = records.size();
+    const auto * begin = reinterpret_cast<const std::uint8_t *>(records.data());  // NOLINT
+    data->insert(data->end(), begin, begin + records.size() * sizeof(T));
+  }
+
+  PrimitiveTable<lanelet::ConstPoint3d> points_;
+  PrimitiveTable<lanelet::ConstLineString3d> line_strings_;
+  PrimitiveTable<lanelet::ConstPolygon3d> polygons_;
+  PrimitiveTable<lanelet::ConstLanelet> lanelets_;
+  PrimitiveTable<lanelet::ConstArea> areas_;
+  PrimitiveTable<lanelet::RegulatoryElementConstPtr> regulatory_elements_;
+
+  std::vector<std::uint32_t> point_refs_;
+  std::vector<flat::BoundRef> bound_refs_;
+  std::vector<flat::Ring> rings_;
+  std::vector<std::uint32_t> regulatory_element_refs_;
+  std::vector<flat::Parameter> parameters_;
+  std::vector<flat::Attribute> attributes_;
+  StringTable strings_;
+};
+
+/**
+ * Builds lanelet2 primitives from flat records on demand. Every record is built at most once, so
+ * primitives shared between lanelets keep sharing their data.
+ */
+class Materializer
+{
+public:
+  explicit Materializer(const FlatMapView & view)
+  : view_(view),
+    points_(view.points().size()),
+    line_strings_(view.lineStrings().size()),
+    polygons_(view.polygons().size()),
+    lanelets_(view.lanelets().size()),
+    areas_(view.areas().size()),
+    regulatory_elements_(view.regulatoryElements().size())
+  {
+  }
+
+  lanelet::Point3d point(const std::uint32_t i)
+  {
+    auto & cached = cacheAt(i, &points_);
+    if (!cached) {
+      const auto & record = at(view_.points(), i);
+      cached = lanelet::Point3d(
+        record.id, record.x, record.y, record.z, attributes(record.attributes));
+    }
+    return *cached;
+  }
+
+  lanelet::LineString3d lineString(const std::uint32_t i)
+  {
+    auto & cached = cacheAt(i, &line_strings_);
+    if (!cached) {
+      const auto & record = at(view_.lineStrings(), i);
+      cached =
+        lanelet::LineString3d(record.id, points(record.points), attributes(record.attributes));
+    }
+    return *cached;
+  }
+
+  lanelet::Polygon3d polygon(const std::uint32_t i)
+  {
+    auto & cached = cacheAt(i, &polygons_);
+    if (!cached) {
+      const auto & record = at(view_.polygons(), i);
+      cached = lanelet::Polygon3d(record.id, points(record.points), attributes(record.attributes));
+    }
+    return *cached;
+  }
+
+  lanelet::Lanelet lanelet(const std::uint32_t i)
+  {
+    if (!cacheAt(i, &lanelets_)) {
+      buildLanelet(i);
+      // regulatory elements may refer back to this lanelet, so they are attached in finish()
+      pending_lanelets_.push_back(i);
+    }
+    return *lanelets_[i];
+  }
+
+  lanelet::Area area(const std::uint32_t i)
+  {
+    if (!cacheAt(i, &areas_)) {
+      buildArea(i);
+      pending_areas_.push_back(i);
+    }
+    return *areas_[i];
+  }
+
+  lanelet::RegulatoryElementPtr regulatoryElement(const std::uint32_t i)
+  {
+    auto & cached = cacheAt(i, &regulatory_elements_);
+    if (!cached) {
+      const auto & record = at(view_.regulatoryElements(), i);
+      lanelet::RuleParameterMap parameters;
+      for (std::uint32_t p = 0; p < record.parameters.count; ++p) {
+        const auto & parameter = at(
+          view_.parameters(), static_cast<std::size_t>(record.parameters.begin) + p);
+        parameters[std::string(view_.string(parameter.role))].push_back(
+          this->parameter(parameter));
+      }
+      const auto attribute_map = attributes(record.attributes);
+      const auto subtype = attribute_map.find(lanelet::AttributeName::Subtype);
+      if (subtype != attribute_map.end()) {
+        try {
+          cached = lanelet::RegulatoryElementFactory::create(
+            subtype->second.value(), record.id, parameters, attribute_map);
+        } catch (const lanelet::InvalidInputError &) {
+          // unknown rule, keep it generic like the osm parser does
+        }
+      }
+      if (!cached || !*cached) {
+        cached =
+          std::make_shared<lanelet::GenericRegulatoryElement>(record.id, parameters, attribute_map);
+      }
+    }
+    return *cached;
+  }
+
+  /// attaches regulatory elements to every lanelet and area built so far
+  void finish()
+  {
+    while (!pending_lanelets_.empty() || !pending_areas_.empty()) {
+      if (!pending_lanelets_.empty()) {
+        const auto i = pending_lanelets_.back();
+        pending_lanelets_.pop_back();
+        const auto & record = view_.lanelets()[i];
+        auto & lanelet = *lanelets_[i];
+        for (const auto ref : regulatoryElementRefs(record.regulatory_elements)) {
+          lanelet.addRegulatoryElement(regulatoryElement(ref));
+        }
+        continue;
+      }
+      const auto i = pending_areas_.back();
+      pending_areas_.pop_back();
+      const auto & record = view_.areas()[i];
+      auto & area = *areas_[i];
+      for (const auto ref : regulatoryElementRefs(record.regulatory_elements)) {
+        area.addRegulatoryElement(regulatoryElement(ref));
+      }
+    }
+  }
+
+  /**
+   * [buildAll builds every record, one section after the other. Records only refer to sections
+   * built before their own (regulatory elements come last), so the records of a section are built
+   * concurrently; regulatory elements are attached to lanelets and areas in a final single-threaded
+   * pass]
+   */
+  void buildAll()
+  {
+    using lanelet::utils::impl::parallelFor;
+    parallelFor(points_.size(), [this](const std::size_t i) { point(index(i)); });
+    parallelFor(line_strings_.size(), [this](const std::size_t i) { lineString(index(i)); });
+    parallelFor(polygons_.size(), [this](const std::size_t i) { polygon(index(i)); });
+    parallelFor(lanelets_.size(), [this](const std::size_t i) { buildLanelet(index(i)); });
+    parallelFor(areas_.size(), [this](const std::size_t i) { buildArea(index(i)); });
+    parallelFor(
+      regulatory_elements_.size(), [this](const std::size_t i) { regulatoryElement(index(i)); });
+
+    for (std::uint32_t i = 0; i < lanelets_.size(); ++i) {
+      pending_lanelets_.push_back(i);
+    }
+    for (std::uint32_t i = 0; i < areas_.size(); ++i) {
+      pending_areas_.push_back(i);
+    }
+    finish();
+  }
+
+  const std::vector<std::optional<lanelet::Point3d>> & builtPoints() const { return points_; }
+  const std::vector<std::optional<lanelet::LineString3d>> & builtLineStrings() const
+  {
+    return line_strings_;
+  }
+  const std::vector<std::optional<lanelet::Polygon3d>> & builtPolygons() const { return polygons_; }
+  const std::vector<std::optional<lanelet::Lanelet>> & builtLanelets() const { return lanelets_; }
+  const std::vector<std::optional<lanelet::Area>> & builtAreas() const { return areas_; }
+  const std::vector<std::optional<lanelet::RegulatoryElementPtr>> & builtRegulatoryElements() const
+  {
+    return regulatory_elements_;
+  }
+
+private:
+  static std::uint32_t index(const std::size_t i) { return static_cast<std::uint32_t>(i); }
+
+  void buildLanelet(const std::uint32_t i)
+  {
+    const auto & record = at(view_.lanelets(), i);
+    auto & cached = lanelets_[i];
+    cached = lanelet::Lanelet(
+      record.id, bound(record.left), bound(record.right), attributes(record.attributes));
+    if (record.centerline != flat::invalid_index) {
+      cached->setCenterline(lineString(record.centerline));
+    }
+  }
+
+  void buildArea(const std::uint32_t i)
+  {
+    const auto & record = at(view_.areas(), i);
+    lanelet::InnerBounds inner_bounds;
+    inner_bounds.reserve(record.inner_rings.count);
+    for (std::uint32_t r = 0; r < record.inner_rings.count; ++r) {
+      inner_bounds.push_back(ring(record.inner_rings.begin + r));
+    }
+    areas_[i] = lanelet::Area(
+      record.id, ring(record.outer_ring), inner_bounds, attributes(record.attributes));
+  }
+
+  template <typename T>
+  static std::optional<T> & cacheAt(const std::uint32_t i, std::vector<std::optional<T>> * cache)
+  {
+    if (i >= cache->size()) {
+      throw std::runtime_error("flat map refers to a record out of range");
+    }
+    return (*cache)[i];
+  }
+
+  lanelet::AttributeMap attributes(const flat::Range & range) const
+  {
+    lanelet::AttributeMap attribute_map;
+    for (std::uint32_t a = 0; a < range.count; ++a) {
+      const auto & attribute = at(
+        view_.attributes(), static_cast<std::size_t>(range.begin) + a);
+      attribute_map[std::string(view_.string(attribute.key))] =
+        lanelet::Attribute(std::string(view_.string(attribute.value)));
+    }
+    return attribute_map;
+  }
+
+  lanelet::Points3d points(const flat::Range & range)
+  {
+    lanelet::Points3d result;
+    result.reserve(range.count);
+    for (std::uint32_t p = 0; p < range.count; ++p) {
+      result.push_back(point(at(
+        view_.pointRefs(), static_cast<std::size_t>(range.begin) + p)));
+    }
+    return result;
+  }
+
+  lanelet::LineString3d bound(const flat::BoundRef & ref)
+  {
+    const auto line_string = lineString(ref.linestring);
+    return ref.inverted != 0U ? line_string.invert() : line_string;
+  }
+
+  lanelet::LineStrings3d ring(const std::uint32_t i)
+  {
+    const auto & record = at(view_.rings(), i);
+    lanelet::LineStrings3d bounds;
+    bounds.reserve(record.bounds.count);
+    for (std::uint32_t b = 0; b < record.bounds.count; ++b) {
+      bounds.push_back(bound(at(
+        view_.boundRefs(), static_cast<std::size_t>(record.bounds.begin) + b)));
+    }
+    return bounds;
+  }
+
+  std::vector<std::uint32_t> regulatoryElementRefs(const flat::Range & range) const
+  {
+    std::vector<std::uint32_t> refs;
+    refs.reserve(range.count);
+    for (std::uint32_t r = 0; r < range.count; ++r) {
+      refs.push_back(at(
+        view_.regulatoryElementRefs(), static_cast<std::size_t>(range.begin) + r));
+    }
+    return refs;
+  }
+
+  lanelet::RuleParameter parameter(const flat::Parameter & parameter)
+  {
+    switch (parameter.kind) {
+      case flat::ParameterKind::Point:
+        return point(parameter.index);
+      case flat::ParameterKind::LineString: {
+        const auto line_string = lineString(parameter.index);
+        return parameter.inverted != 0U ? line_string.invert() : line_string;
+      }
+      case flat::ParameterKind::Polygon: {
+        const auto poly = polygon(parameter.index);
+        return parameter.inverted != 0U ? poly.invert() : poly;
+      }
+      case flat::ParameterKind::Lanelet:
+        return lanelet::WeakLanelet(lanelet(parameter.index));
+      case flat::ParameterKind::Area:
+        return lanelet::WeakArea(area(parameter.index));
+      default:
+        throw std::runtime_error("flat map has an unknown regulatory element parameter kind");
+    }
+  }
+
+  const FlatMapView & view_;
+  std::vector<std::optional<lanelet::Point3d>> points_;
+  std::vector<std::optional<lanelet::LineString3d>> line_strings_;
+  std::vector<std::optional<lanelet::Polygon3d>> polygons_;
+  std::vector<std::optional<lanelet::Lanelet>> lanelets_;
+  std::vector<std::optional<lanelet::Area>> areas_;
+  std::vector<std::optional<lanelet::RegulatoryElementPtr>> regulatory_elements_;
+  std::vector<std::uint32_t> pending_lanelets_;
+  std::vector<std::uint32_t> pending_areas_;
+};
+
+template <typename Record, typename T>
+std::unordered_map<lanelet::Id, T> layerMap(
+  const flat::Span<Record> & records, const std::vector<std::optional<T>> & built,
+  const bool requested)
+{
+  std::unordered_map<lanelet::Id, T> layer;
+  if (!requested) {
+    return layer;
+  }
+  layer.reserve(records.size());
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    if ((records[i].flags & flat::flag_in_layer) != 0U && built[i]) {
+      layer.emplace(records[i].id, *built[i]);
+    }
+  }
+  return layer;
+}
+}  // namespace
+
+FlatMapView::FlatMapView(const std::uint8_t * data, const std::size_t size)
+{
+  if (data == nullptr || size < sizeof(flat::Header)) {
+    throw std::runtime_error("flat map is smaller than its header");
+  }
+  if (reinterpret_cast<std::uintptr_t>(data) % alignof(flat::Header) != 0) {  // NOLINT
+    throw std::runtime_error("flat map buffer is not aligned");
+  }
+  header_ = reinterpret_cast<const flat::Header *>(data);  // NOLINT
+  if (std::memcmp(header_->magic, flat::magic, sizeof(flat::magic)) != 0) {
+    throw std::runtime_error("buffer is not a flat map");
+  }
+  if (header_->endianness != flat::endianness_marker) {
+    throw std::runtime_error("flat map was written on a host with a different byte order");
+  }
+  if (header_->version != flat::format_version || header_->section_count != flat::section_count) {
+    throw std::runtime_error(
+      "unsupported flat map version " + std::to_string(header_->version));
+  }
+
+  const auto section = [&](const flat::Section id, auto * span) {
+    using T = std::remove_cv_t<std::remove_pointer_t<decltype(span->begin())>>;
+    const auto & entry = header_->sections[static_cast<std::size_t>(id)];
+    if (
+      entry.offset % section_alignment != 0 || entry.offset > size ||
+      entry.count > (size - entry.offset) / sizeof(T)) {
+      throw std::runtime_error("flat map section is out of bounds");
+    }
+    *span = flat::Span<T>(
+      reinterpret_cast<const T *>(data + entry.offset),  // NOLINT
+      static_cast<std::size_t>(entry.count));
+  };
+  section(flat::Section::Points, &points_);
+  section(flat::Section::LineStrings, &line_strings_);
+  section(flat::Section::Polygons, &polygons_);
+  section(flat::Section::Lanelets, &lanelets_);
+  section(flat::Section::Areas, &areas_);
+  section(flat::Section::RegulatoryElements, &regulatory_elements_);
+  section(flat::Section::PointRefs, &point_refs_);
+  section(flat::Section::BoundRefs, &bound_refs_);
+  section(flat::Section::Rings, &rings_);
+  section(flat::Section::RegulatoryElementRefs, &regulatory_element_refs_);
+  section(flat::Section::Parameters, &parameters_);
+  section(flat::Section::Attributes, &attributes_);
+  section(flat::Section::StringOffsets, &string_offsets_);
+  section(flat::Section::StringData, &string_data_);
+}
+
+std::string_view FlatMapView::string(const std::uint32_t index) const
+{
+  if (index >= string_offsets_.size()) {
+    throw std::out_of_range("flat map string index out of range");
+  }
+  const auto & offset = string_offsets_[index];
+  if (
+    offset.begin > string_data_.size() || offset.length > string_data_.size() - offset.begin) {
+    throw std::out_of_range("flat map string is out of bounds");
+  }
+  return {string_data_.begin() + offset.begin, offset.length};
+}
+
+std::optional<std::uint32_t> FlatMapView::findPoint(const lanelet::Id id) const
+{
+  return findById(points_, id);
+}
+
+std::optional<std::uint32_t> FlatMapView::findLineString(const lanelet::Id id) const
+{
+  return findById(line_strings_, id);
+}
+
+std::optional<std::uint32_t> FlatMapView::findPolygon(const lanelet::Id id) const
+{
+  return findById(polygons_, id);
+}
+
+std::optional<std::uint32_t> FlatMapView::findLanelet(const lanelet::Id id) const
+{
+  return findById(lanelets_, id);
+}
+
+std::optional<std::uint32_t> FlatMapView::findArea(const lanelet::Id id) const
+{
+  return findById(areas_, id);
+}
+
+std::optional<std::uint32_t> FlatMapView::findRegulatoryElement(const lanelet::Id id) const
+{
+  return findById(regulatory_elements_, id);
+}
+
+std::vector<std::uint32_t> FlatMapView::laneletsInBox(const lanelet::BoundingBox2d & box) const
+{
+  std::vector<std::uint32_t> indices;
+  for (std::size_t i = 0; i < lanelets_.size(); ++i) {
+    const auto & bbox = lanelets_[i].bbox;
+    if (
+      bbox.max_x < box.min().x() || box.max().x() < bbox.min_x || bbox.max_y < box.min().y() ||
+      box.max().y() < bbox.min_y) {
+      continue;
+    }
+    indices.push_back(static_cast<std::uint32_t>(i));
+  }
+  return indices;
+}
+
+FlatMapFile::FlatMapFile(const std::string & filename)
+{
+  const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT
+  if (fd < 0) {
+    throw std::runtime_error("failed to open " + filename + ": " + std::strerror(errno));
+  }
+  struct stat file_stat = {};
+  if (::fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    ::close(fd);
+    throw std::runtime_error("failed to stat " + filename);
+  }
+  size_ = static_cast<std::size_t>(file_stat.st_size);
+  address_ = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (address_ == MAP_FAILED) {  // NOLINT
+    address_ = nullptr;
+    throw std::runtime_error("failed to map " + filename + ": " + std::strerror(errno));
+  }
+
+  try {
+    view_.emplace(static_cast<const std::uint8_t *>(address_), size_);
+  } catch (...) {
+    ::munmap(address_, size_);
+    throw;
+  }
+}
+
+FlatMapFile::~FlatMapFile()
+{
+  if (address_ != nullptr) {
+    ::munmap(address_, size_);
+  }
+}
+
+void writeFlatMap(const lanelet::LaneletMap & map, std::vector<std::uint8_t> * data)
+{
+  FlatMapWriter(map).write(data);
+}
+
+void writeFlatMap(const lanelet::LaneletMap & map, const std::string & filename)
+{
+  std::vector<std::uint8_t> data;
+  writeFlatMap(map, &data);
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  file.write(
+    reinterpret_cast<const char *>(data.data()),  // NOLINT
+    static_cast<std::streamsize>(data.size()));
+  if (!file) {
+    throw std::runtime_error("failed to write " + filename);
+  }
+}
+
+lanelet::LaneletMapPtr materialize(const FlatMapView & view)
+{
+  return materialize(view, flat::Layer::All);
+}
+
+lanelet::LaneletMapPtr materialize(const FlatMapView & view, const std::uint32_t layers)
+{
+  const auto requested = [layers](const std::uint32_t layer) { return (layers & layer) != 0U; };
+
+  Materializer materializer(view);
+  if (layers == flat::Layer::All) {
+    materializer.buildAll();
+  } else {
+    if (requested(flat::Layer::Points)) {
+      for (std::uint32_t i = 0; i < view.points().size(); ++i) {
+        materializer.point(i);
+      }
+    }
+    if (requested(flat::Layer::LineStrings)) {
+      for (std::uint32_t i = 0; i < view.lineStrings().size(); ++i) {
+        materializer.lineString(i);
+      }
+    }
+    if (requested(flat::Layer::Polygons)) {
+      for (std::uint32_t i = 0; i < view.polygons().size(); ++i) {
+        materializer.polygon(i);
+      }
+    }
+    if (requested(flat::Layer::Lanelets)) {
+      for (std::uint32_t i = 0; i < view.lanelets().size(); ++i) {
+        materializer.lanelet(i);
+      }
+    }
+    if (requested(flat::Layer::Areas)) {
+      for (std::uint32_t i = 0; i < view.areas().size(); ++i) {
+        materializer.area(i);
+      }
+    }
+    if (requested(flat::Layer::RegulatoryElements)) {
+      for (std::uint32_t i = 0; i < view.regulatoryElements().size(); ++i) {
+        materializer.regulatoryElement(i);
+      }
+    }
+    materializer.finish();
+  }
+
+  auto map = std::make_shared<lanelet::LaneletMap>(
+    layerMap(view.lanelets(), materializer.builtLanelets(), requested(flat::Layer::Lanelets)),
+    layerMap(view.areas(), materializer.builtAreas(), requested(flat::Layer::Areas)),
+    layerMap(
+      view.regulatoryElements(), materializer.builtRegulatoryElements(),
+      requested(flat::Layer::RegulatoryElements)),
+    layerMap(view.polygons(), materializer.builtPolygons(), requested(flat::Layer::Polygons)),
+    layerMap(
+      view.lineStrings(), materializer.builtLineStrings(), requested(flat::Layer::LineStrings)),
+    layerMap(view.points(), materializer.builtPoints(), requested(flat::Layer::Points)));
+  lanelet::utils::registerId(view.idCounter());
+  return map;
+}
+
+lanelet::LaneletMapPtr materializeLanelets(
+  const FlatMapView & view, const std::vector<std::uint32_t> & lanelet_indices)
+{
+  Materializer materializer(view);
+  lanelet::Lanelets lanelets;
+  lanelets.reserve(lanelet_indices.size());
+  for (const auto i : lanelet_indices) {
+    lanelets.push_back(materializer.lanelet(i));
+  }
+  materializer.finish();
+
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  for (auto & lanelet : lanelets) {
+    map->add(lanelet);
+  }
+  lanelet::utils::registerId(view.idCounter());
+  return map;
+}
+
+lanelet::LaneletMapPtr materializeWithin(
+  const FlatMapView & view, const lanelet::BoundingBox2d & box)
+{
+  return materializeLanelets(view, view.laneletsInBox(box));
+}
+}  // namespace lanelet::io_handlers
+
+// NOLINTEND(readability-identifier-naming)
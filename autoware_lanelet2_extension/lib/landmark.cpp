@@ -14,15 +14,13 @@
 
 #include "autoware_lanelet2_extension/localization/landmark.hpp"
 
-#include <Eigen/Core>
+#include "bin_msg_codec.hpp"
 
-#include <boost/archive/binary_iarchive.hpp>
+#include <Eigen/Core>
 
 #include <lanelet2_core/LaneletMap.h>
-#include <lanelet2_io/io_handlers/Serialize.h>
 
 #include <iostream>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -36,15 +34,9 @@ static void fromBinMsg(
     return;
   }
 
-  std::string data_str;
-  data_str.assign(msg.data.begin(), msg.data.end());
-
-  std::stringstream ss;
-  ss << data_str;
-  boost::archive::binary_iarchive oa(ss);
-  oa >> *map;
-  lanelet::Id id_counter = 0;
-  oa >> id_counter;
+  // landmarks are polygons, so a flat payload only needs its polygon layer decoded
+  const auto id_counter = lanelet::utils::conversion::impl::readMapPayload(
+    msg.data, map.get(), nullptr, lanelet::utils::conversion::BinMsgLayer::Polygons);
   lanelet::utils::registerId(id_counter);
 }
 }  // namespace impl
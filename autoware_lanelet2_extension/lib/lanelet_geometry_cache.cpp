@@ -0,0 +1,131 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/lanelet_geometry_cache.hpp"
+
+#include "./parallel.hpp"
+
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils
+{
+namespace
+{
+// computing one entry is cheap, so hand out blocks of lanelets to keep the threads busy
+constexpr std::size_t cache_chunk_size = 64;
+
+LaneletGeometry computeGeometry(const lanelet::ConstLanelet & lanelet)
+{
+  LaneletGeometry geometry;
+  geometry.length2d = lanelet::geometry::length2d(lanelet);
+  geometry.length3d = lanelet::geometry::length3d(lanelet);
+  geometry.bounding_box = lanelet::geometry::boundingBox2d(lanelet);
+  geometry.polygon = lanelet.polygon2d().basicPolygon();
+  return geometry;
+}
+}  // namespace
+
+struct LaneletGeometryCache::Impl
+{
+  std::vector<LaneletGeometry> geometries;
+  std::unordered_map<lanelet::Id, std::size_t> positions;  // of each lanelet in `geometries`
+
+  const LaneletGeometry * find(const lanelet::Id id) const
+  {
+    const auto it = positions.find(id);
+    return it == positions.end() ? nullptr : &geometries[it->second];
+  }
+};
+
+LaneletGeometryCache::LaneletGeometryCache() : impl_(std::make_shared<const Impl>())
+{
+}
+
+LaneletGeometryCache::LaneletGeometryCache(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const std::size_t max_threads)
+: LaneletGeometryCache()
+{
+  if (!lanelet_map_ptr) {
+    std::cerr << __FUNCTION__ << ": lanelet_map_ptr is null pointer!" << std::endl;
+    return;
+  }
+  const lanelet::ConstLanelets lanelets(
+    lanelet_map_ptr->laneletLayer.begin(), lanelet_map_ptr->laneletLayer.end());
+  *this = LaneletGeometryCache(lanelets, max_threads);
+}
+
+LaneletGeometryCache::LaneletGeometryCache(
+  const lanelet::ConstLanelets & lanelets, const std::size_t max_threads)
+{
+  auto cache = std::make_shared<Impl>();
+
+  // lanelet2 computes centerlines lazily into data shared by a lanelet and its inversion, so
+  // every lanelet must be visited by only one thread
+  lanelet::ConstLanelets unique_lanelets;
+  unique_lanelets.reserve(lanelets.size());
+  cache->positions.reserve(lanelets.size());
+  for (const auto & llt : lanelets) {
+    if (cache->positions.emplace(llt.id(), unique_lanelets.size()).second) {
+      unique_lanelets.push_back(llt.inverted() ? llt.invert() : llt);
+    }
+  }
+
+  cache->geometries.resize(unique_lanelets.size());
+  impl::parallelFor(
+    unique_lanelets.size(),
+    [&](const std::size_t i) { cache->geometries[i] = computeGeometry(unique_lanelets[i]); },
+    cache_chunk_size, max_threads);
+  impl_ = std::move(cache);
+}
+
+const LaneletGeometry * LaneletGeometryCache::find(const lanelet::ConstLanelet & lanelet) const
+{
+  return lanelet.inverted() ? nullptr : impl_->find(lanelet.id());
+}
+
+double LaneletGeometryCache::length2d(const lanelet::ConstLanelet & lanelet) const
+{
+  // the length does not depend on the orientation
+  const auto * geometry = impl_->find(lanelet.id());
+  return geometry ? geometry->length2d : lanelet::geometry::length2d(lanelet);
+}
+
+double LaneletGeometryCache::length3d(const lanelet::ConstLanelet & lanelet) const
+{
+  const auto * geometry = impl_->find(lanelet.id());
+  return geometry ? geometry->length3d : lanelet::geometry::length3d(lanelet);
+}
+
+std::size_t LaneletGeometryCache::size() const
+{
+  return impl_->geometries.size();
+}
+
+bool LaneletGeometryCache::empty() const
+{
+  return impl_->geometries.empty();
+}
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,203 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/lanelet_subset_index.hpp"
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace bgi = boost::geometry::index;
+
+namespace lanelet::utils
+{
+namespace
+{
+using TreeNode = std::pair<lanelet::BoundingBox2d, std::size_t>;
+using RTree = bgi::rtree<TreeNode, bgi::quadratic<16>>;
+
+lanelet::BoundingBox2d searchBox(const lanelet::BasicPoint2d & point, const double range)
+{
+  const lanelet::BasicPoint2d offset(range, range);
+  const lanelet::BasicPoint2d min_corner = point - offset;
+  const lanelet::BasicPoint2d max_corner = point + offset;
+  return lanelet::BoundingBox2d(min_corner, max_corner);
+}
+}  // namespace
+
+struct LaneletSubsetIndex::Impl
+{
+  lanelet::ConstLanelets lanelets;
+  std::vector<lanelet::BasicPolygon2d> polygons;  // polygon2d() of every lanelet
+  RTree tree;
+
+  /// positions in `lanelets` of the tree nodes matching the predicate, in ascending order
+  template <typename PredicateT>
+  std::vector<std::size_t> query(const PredicateT & predicate) const
+  {
+    std::vector<TreeNode> nodes;
+    tree.query(predicate, std::back_inserter(nodes));
+    std::vector<std::size_t> indices;
+    indices.reserve(nodes.size());
+    for (const auto & node : nodes) {
+      indices.push_back(node.second);
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+
+  double distance(const std::size_t index, const lanelet::BasicPoint2d & point) const
+  {
+    return lanelet::geometry::distance(polygons[index], point);
+  }
+};
+
+LaneletSubsetIndex::LaneletSubsetIndex() : LaneletSubsetIndex(lanelet::ConstLanelets{})
+{
+}
+
+LaneletSubsetIndex::LaneletSubsetIndex(const lanelet::ConstLanelets & lanelets)
+{
+  auto impl = std::make_shared<Impl>();
+  impl->lanelets = lanelets;
+  impl->polygons.reserve(lanelets.size());
+  std::vector<TreeNode> nodes;
+  nodes.reserve(lanelets.size());
+  for (std::size_t i = 0; i < lanelets.size(); ++i) {
+    impl->polygons.push_back(lanelets[i].polygon2d().basicPolygon());
+    nodes.emplace_back(lanelet::geometry::boundingBox2d(lanelets[i]), i);
+  }
+  // bulk loading packs the tree, which is faster to build and to query than inserting one by one
+  impl->tree = RTree(nodes.begin(), nodes.end());
+  impl_ = std::move(impl);
+}
+
+const lanelet::ConstLanelets & LaneletSubsetIndex::lanelets() const
+{
+  return impl_->lanelets;
+}
+
+std::size_t LaneletSubsetIndex::size() const
+{
+  return impl_->lanelets.size();
+}
+
+bool LaneletSubsetIndex::empty() const
+{
+  return impl_->lanelets.empty();
+}
+
+lanelet::ConstLanelets LaneletSubsetIndex::contains(const lanelet::BasicPoint2d & point) const
+{
+  lanelet::ConstLanelets result;
+  for (const auto index : impl_->query(bgi::intersects(lanelet::BoundingBox2d(point, point)))) {
+    if (boost::geometry::within(point, impl_->polygons[index])) {
+      result.push_back(impl_->lanelets[index]);
+    }
+  }
+  return result;
+}
+
+lanelet::ConstLanelets LaneletSubsetIndex::nearest(
+  const lanelet::BasicPoint2d & point, const std::size_t k) const
+{
+  if (k == 0 || empty()) {
+    return {};
+  }
+
+  // the k nearest bounding boxes bound the distance of the k nearest polygons from above, and
+  // every lanelet within that distance has its bounding box within it as well
+  double max_distance = 0.0;
+  for (const auto index : impl_->query(bgi::nearest(point, static_cast<unsigned>(k)))) {
+    max_distance = std::max(max_distance, impl_->distance(index, point));
+  }
+
+  std::vector<std::pair<double, std::size_t>> candidates;
+  for (const auto index : impl_->query(bgi::intersects(searchBox(point, max_distance)))) {
+    candidates.emplace_back(impl_->distance(index, point), index);
+  }
+  const auto count = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+
+  lanelet::ConstLanelets result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(impl_->lanelets[candidates[i].second]);
+  }
+  return result;
+}
+
+lanelet::ConstLanelets LaneletSubsetIndex::withinRange(
+  const lanelet::BasicPoint2d & point, const double range) const
+{
+  lanelet::ConstLanelets result;
+  if (range < 0.0) {
+    return result;
+  }
+  for (const auto index : impl_->query(bgi::intersects(searchBox(point, range)))) {
+    if (impl_->distance(index, point) <= range) {
+      result.push_back(impl_->lanelets[index]);
+    }
+  }
+  return result;
+}
+
+std::vector<std::pair<lanelet::ConstLanelet, double>> LaneletSubsetIndex::distancesWithinRange(
+  const lanelet::BasicPoint2d & point, const double range) const
+{
+  std::vector<std::pair<lanelet::ConstLanelet, double>> result;
+  if (range < 0.0) {
+    return result;
+  }
+  for (const auto index : impl_->query(bgi::intersects(searchBox(point, range)))) {
+    const double distance = impl_->distance(index, point);
+    if (distance <= range) {
+      result.emplace_back(impl_->lanelets[index], distance);
+    }
+  }
+  return result;
+}
+
+lanelet::ConstLanelets LaneletSubsetIndex::intersecting(
+  const lanelet::BasicPolygon2d & polygon) const
+{
+  lanelet::ConstLanelets result;
+  if (polygon.empty()) {
+    return result;
+  }
+  lanelet::BoundingBox2d box(polygon.front(), polygon.front());
+  for (const auto & point : polygon) {
+    box.extend(point);
+  }
+  for (const auto index : impl_->query(bgi::intersects(box))) {
+    if (boost::geometry::intersects(impl_->polygons[index], polygon)) {
+      result.push_back(impl_->lanelets[index]);
+    }
+  }
+  return result;
+}
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
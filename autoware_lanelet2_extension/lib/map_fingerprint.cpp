@@ -0,0 +1,331 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+#include "autoware_lanelet2_extension/utility/utilities.hpp"
+#include "bin_msg_codec.hpp"
+#include "fingerprint_hasher.hpp"
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/RegulatoryElement.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace lanelet::utils::conversion
+{
+namespace
+{
+/// distinguishes primitives of different kinds with the same content
+enum class Tag : std::uint8_t {
+  Point = 1,
+  LineString,
+  Polygon,
+  Lanelet,
+  Area,
+  RegulatoryElement,
+  Attribute,
+  Parameter,
+  Map,
+};
+
+/// hashes one primitive, starting with its kind
+class Hasher : public impl::FingerprintHasher
+{
+public:
+  explicit Hasher(const Tag tag) : impl::FingerprintHasher(static_cast<std::uint8_t>(tag)) {}
+};
+
+using impl::mixFingerprint;
+
+void addAttributes(Hasher * hasher, const lanelet::AttributeMap & attributes)
+{
+  // summed so that the result does not depend on the iteration order of the map
+  std::uint64_t sum = 0;
+  for (const auto & attribute : attributes) {
+    Hasher attribute_hasher(Tag::Attribute);
+    attribute_hasher.add(attribute.first);
+    attribute_hasher.add(attribute.second.value());
+    sum += mixFingerprint(attribute_hasher.value());
+  }
+  hasher->add(sum);
+}
+
+void addPoint(Hasher * hasher, const lanelet::ConstPoint3d & point)
+{
+  hasher->add(point.id());
+  hasher->add(point.x());
+  hasher->add(point.y());
+  hasher->add(point.z());
+}
+
+/// hashes a reference to a linestring or polygon as seen by its user
+template <typename LineStringT>
+void addReference(Hasher * hasher, const LineStringT & line_string)
+{
+  hasher->add(line_string.id());
+  hasher->add(line_string.inverted());
+}
+
+/// hashes the stored content of a linestring or polygon
+template <typename LineStringT>
+void addLineString(Hasher * hasher, const LineStringT & line_string)
+{
+  const auto stored = line_string.inverted() ? line_string.invert() : line_string;
+  hasher->add(stored.id());
+  hasher->add(static_cast<std::uint64_t>(stored.size()));
+  for (const auto & point : stored) {
+    hasher->add(point.id());
+  }
+  addAttributes(hasher, stored.attributes());
+}
+
+template <typename PrimitiveT>
+void addRegulatoryElementIds(Hasher * hasher, const PrimitiveT & primitive)
+{
+  const auto regulatory_elements = primitive.regulatoryElements();
+  hasher->add(static_cast<std::uint64_t>(regulatory_elements.size()));
+  for (const auto & regulatory_element : regulatory_elements) {
+    hasher->add(regulatory_element->id());
+  }
+}
+
+class ParameterHasher : public boost::static_visitor<void>
+{
+public:
+  explicit ParameterHasher(Hasher * hasher) : hasher_(hasher) {}
+
+  void operator()(const lanelet::ConstPoint3d & point) const
+  {
+    hasher_->add(static_cast<std::uint8_t>(Tag::Point));
+    hasher_->add(point.id());
+  }
+  void operator()(const lanelet::ConstLineString3d & line_string) const
+  {
+    hasher_->add(static_cast<std::uint8_t>(Tag::LineString));
+    addReference(hasher_, line_string);
+  }
+  void operator()(const lanelet::ConstPolygon3d & polygon) const
+  {
+    hasher_->add(static_cast<std::uint8_t>(Tag::Polygon));
+    addReference(hasher_, polygon);
+  }
+  void operator()(const lanelet::ConstWeakLanelet & lanelet) const
+  {
+    hasher_->add(static_cast<std::uint8_t>(Tag::Lanelet));
+    hasher_->add(lanelet.expired() ? lanelet::InvalId : lanelet.lock().id());
+  }
+  void operator()(const lanelet::ConstWeakArea & area) const
+  {
+    hasher_->add(static_cast<std::uint8_t>(Tag::Area));
+    hasher_->add(area.expired() ? lanelet::InvalId : area.lock().id());
+  }
+
+private:
+  Hasher * hasher_;
+};
+
+std::uint64_t hashLanelet(const lanelet::ConstLanelet & lanelet, const lanelet::LaneletMap & map)
+{
+  Hasher hasher(Tag::Lanelet);
+  hasher.add(lanelet.id());
+  addReference(&hasher, lanelet.leftBound());
+  addReference(&hasher, lanelet.rightBound());
+  hasher.add(lanelet.hasCustomCenterline());
+  if (lanelet.hasCustomCenterline()) {
+    // custom centerlines are usually in no layer, so their content is part of the lanelet
+    const auto centerline = lanelet.centerline();
+    addLineString(&hasher, centerline);
+    if (!map.lineStringLayer.exists(centerline.id())) {
+      for (const auto & point : centerline) {
+        addPoint(&hasher, point);
+      }
+    }
+  }
+  addRegulatoryElementIds(&hasher, lanelet);
+  addAttributes(&hasher, lanelet.attributes());
+  return hasher.value();
+}
+
+std::uint64_t hashArea(const lanelet::ConstArea & area)
+{
+  Hasher hasher(Tag::Area);
+  hasher.add(area.id());
+  const auto outer = area.outerBound();
+  hasher.add(static_cast<std::uint64_t>(outer.size()));
+  for (const auto & bound : outer) {
+    addReference(&hasher, bound);
+  }
+  const auto inner = area.innerBounds();
+  hasher.add(static_cast<std::uint64_t>(inner.size()));
+  for (const auto & ring : inner) {
+    hasher.add(static_cast<std::uint64_t>(ring.size()));
+    for (const auto & bound : ring) {
+      addReference(&hasher, bound);
+    }
+  }
+  addRegulatoryElementIds(&hasher, area);
+  addAttributes(&hasher, area.attributes());
+  return hasher.value();
+}
+
+std::uint64_t hashRegulatoryElement(const lanelet::RegulatoryElement & regulatory_element)
+{
+  Hasher hasher(Tag::RegulatoryElement);
+  hasher.add(regulatory_element.id());
+  const ParameterHasher parameter_hasher(&hasher);
+  for (const auto & role : regulatory_element.getParameters()) {
+    hasher.add(static_cast<std::uint8_t>(Tag::Parameter));
+    hasher.add(role.first);
+    hasher.add(static_cast<std::uint64_t>(role.second.size()));
+    for (const auto & parameter : role.second) {
+      boost::apply_visitor(parameter_hasher, parameter);
+    }
+  }
+  addAttributes(&hasher, regulatory_element.attributes());
+  return hasher.value();
+}
+
+/// identifies a payload in the cache of fromBinMsgShared
+struct SharedMapKey
+{
+  bool content{false};  // true for the content fingerprint, false for a hash of the payload bytes
+  std::uint64_t value{0};
+
+  bool operator==(const SharedMapKey & other) const
+  {
+    return content == other.content && value == other.value;
+  }
+};
+
+SharedMapKey sharedMapKey(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  if (const auto fingerprint = peekFingerprint(msg)) {
+    return {true, *fingerprint};
+  }
+  // legacy payloads carry no fingerprint. Equal bytes decode to the same map and id counter, and
+  // hashing them is cheap next to decoding
+  Hasher hasher(Tag::Map);
+  hasher.add(msg.data.data(), msg.data.size());
+  return {false, hasher.value()};
+}
+
+/// the last map decoded by fromBinMsgShared
+struct SharedMapCache
+{
+  std::mutex mutex;
+  std::optional<SharedMapKey> key;
+  lanelet::Id id_counter{0};
+  lanelet::LaneletMapConstPtr map;
+};
+
+SharedMapCache & sharedMapCache()
+{
+  static SharedMapCache cache;
+  return cache;
+}
+}  // namespace
+
+std::uint64_t computeFingerprint(const lanelet::LaneletMap & map)
+{
+  // every primitive is hashed on its own and the hashes are summed, which makes the result
+  // independent of the iteration order of the layers
+  std::uint64_t fingerprint = 0;
+  for (const auto & point : map.pointLayer) {
+    Hasher hasher(Tag::Point);
+    addPoint(&hasher, point);
+    addAttributes(&hasher, point.attributes());
+    fingerprint += mixFingerprint(hasher.value());
+  }
+  for (const auto & line_string : map.lineStringLayer) {
+    Hasher hasher(Tag::LineString);
+    addLineString(&hasher, line_string);
+    fingerprint += mixFingerprint(hasher.value());
+  }
+  for (const auto & polygon : map.polygonLayer) {
+    Hasher hasher(Tag::Polygon);
+    addLineString(&hasher, polygon);
+    fingerprint += mixFingerprint(hasher.value());
+  }
+  for (const auto & lanelet : map.laneletLayer) {
+    fingerprint += mixFingerprint(hashLanelet(lanelet, map));
+  }
+  for (const auto & area : map.areaLayer) {
+    fingerprint += mixFingerprint(hashArea(area));
+  }
+  for (const auto & regulatory_element : map.regulatoryElementLayer) {
+    fingerprint += mixFingerprint(hashRegulatoryElement(*regulatory_element));
+  }
+  // 0 marks payloads without fingerprint
+  return fingerprint == 0 ? 1 : fingerprint;
+}
+
+std::optional<std::uint64_t> peekFingerprint(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  if (!impl::hasBinMsgHeader(msg.data.data(), msg.data.size())) {
+    return std::nullopt;
+  }
+  const auto header = impl::readBinMsgHeader(msg.data.data(), msg.data.size());
+  if (header.fingerprint == 0 || (header.flags & impl::BinMsgFlag::Patch) != 0) {
+    return std::nullopt;
+  }
+  return header.fingerprint;
+}
+
+lanelet::LaneletMapConstPtr fromBinMsgShared(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  const auto key = sharedMapKey(msg);
+  auto & cache = sharedMapCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.map && cache.key == key) {
+      lanelet::utils::registerId(cache.id_counter);
+      return cache.map;
+    }
+  }
+
+  // decode outside of the lock, other maps can be served meanwhile
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  const auto id_counter = impl::readMapPayload(msg.data, map.get());
+  lanelet::utils::registerId(id_counter);
+  // lanelet2 computes centerlines lazily and without locking, so they are computed before other
+  // threads can see the map
+  lanelet::utils::warmUpMap(map);
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.key = key;
+  cache.id_counter = id_counter;
+  cache.map = map;
+  return map;
+}
+
+void clearBinMsgCache()
+{
+  auto & cache = sharedMapCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.key.reset();
+  cache.map.reset();
+}
+}  // namespace lanelet::utils::conversion
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,1260 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/map_patch.hpp"
+
+#include "bin_msg_codec.hpp"
+#include "bin_msg_stream.hpp"
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <lanelet2_core/Exceptions.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/RegulatoryElement.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils
+{
+namespace
+{
+using lanelet::io_handlers::flat::ParameterKind;
+
+/// version of the serialized patch, checked when decoding
+constexpr std::uint32_t map_patch_format_version = 2;
+
+bool sameAttributes(const lanelet::AttributeMap & a, const lanelet::AttributeMap & b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (const auto & attribute : a) {
+    const auto it = b.find(attribute.first);
+    if (it == b.end() || it->second.value() != attribute.second.value()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool sameContent(const MapPatch::Point & a, const MapPatch::Point & b)
+{
+  return a.x == b.x && a.y == b.y && a.z == b.z && sameAttributes(a.attributes, b.attributes);
+}
+
+bool sameContent(const MapPatch::LineString & a, const MapPatch::LineString & b)
+{
+  return a.points == b.points && sameAttributes(a.attributes, b.attributes);
+}
+
+bool sameContent(const MapPatch::Lanelet & a, const MapPatch::Lanelet & b)
+{
+  return a.left == b.left && a.right == b.right && a.centerline == b.centerline &&
+         a.regulatory_elements == b.regulatory_elements &&
+         sameAttributes(a.attributes, b.attributes);
+}
+
+bool sameContent(const MapPatch::Area & a, const MapPatch::Area & b)
+{
+  return a.outer == b.outer && a.inner == b.inner &&
+         a.regulatory_elements == b.regulatory_elements &&
+         sameAttributes(a.attributes, b.attributes);
+}
+
+bool sameContent(const MapPatch::RegulatoryElement & a, const MapPatch::RegulatoryElement & b)
+{
+  return a.parameters == b.parameters && sameAttributes(a.attributes, b.attributes);
+}
+
+MapPatch::Point toRecord(const lanelet::ConstPoint3d & point, const bool in_layer)
+{
+  MapPatch::Point record;
+  record.id = point.id();
+  record.x = point.x();
+  record.y = point.y();
+  record.z = point.z();
+  record.attributes = point.attributes();
+  record.in_layer = in_layer;
+  return record;
+}
+
+template <typename LineStringT>
+MapPatch::LineString toRecord(const LineStringT & line_string, const bool in_layer)
+{
+  // the record describes the stored orientation, users of an inverted handle keep the flag
+  const auto stored = line_string.inverted() ? line_string.invert() : line_string;
+  MapPatch::LineString record;
+  record.id = stored.id();
+  record.points.reserve(stored.size());
+  for (const auto & point : stored) {
+    record.points.push_back(point.id());
+  }
+  record.attributes = stored.attributes();
+  record.in_layer = in_layer;
+  return record;
+}
+
+MapPatch::Bound toBound(const lanelet::ConstLineString3d & line_string)
+{
+  return {line_string.id(), line_string.inverted()};
+}
+
+std::vector<MapPatch::Bound> toBounds(const lanelet::ConstLineStrings3d & line_strings)
+{
+  std::vector<MapPatch::Bound> bounds;
+  bounds.reserve(line_strings.size());
+  for (const auto & line_string : line_strings) {
+    bounds.push_back(toBound(line_string));
+  }
+  return bounds;
+}
+
+template <typename PrimitiveT>
+std::vector<lanelet::Id> regulatoryElementIds(const PrimitiveT & primitive)
+{
+  std::vector<lanelet::Id> ids;
+  for (const auto & regulatory_element : primitive.regulatoryElements()) {
+    ids.push_back(regulatory_element->id());
+  }
+  return ids;
+}
+
+MapPatch::Lanelet toRecord(const lanelet::ConstLanelet & lanelet)
+{
+  MapPatch::Lanelet record;
+  record.id = lanelet.id();
+  record.left = toBound(lanelet.leftBound());
+  record.right = toBound(lanelet.rightBound());
+  if (lanelet.hasCustomCenterline()) {
+    record.centerline = lanelet.centerline().id();
+  }
+  record.regulatory_elements = regulatoryElementIds(lanelet);
+  record.attributes = lanelet.attributes();
+  return record;
+}
+
+MapPatch::Area toRecord(const lanelet::ConstArea & area)
+{
+  MapPatch::Area record;
+  record.id = area.id();
+  record.outer = toBounds(area.outerBound());
+  for (const auto & ring : area.innerBounds()) {
+    record.inner.push_back(toBounds(ring));
+  }
+  record.regulatory_elements = regulatoryElementIds(area);
+  record.attributes = area.attributes();
+  return record;
+}
+
+class ParameterRecorder : public boost::static_visitor<void>
+{
+public:
+  ParameterRecorder(const std::string & role, std::vector<MapPatch::Parameter> * parameters)
+  : role_(role), parameters_(parameters)
+  {
+  }
+
+  void operator()(const lanelet::ConstPoint3d & point) const
+  {
+    push(ParameterKind::Point, point.id(), false);
+  }
+  void operator()(const lanelet::ConstLineString3d & line_string) const
+  {
+    push(ParameterKind::LineString, line_string.id(), line_string.inverted());
+  }
+  void operator()(const lanelet::ConstPolygon3d & polygon) const
+  {
+    push(ParameterKind::Polygon, polygon.id(), polygon.inverted());
+  }
+  void operator()(const lanelet::ConstWeakLanelet & lanelet) const
+  {
+    if (!lanelet.expired()) {
+      push(ParameterKind::Lanelet, lanelet.lock().id(), false);
+    }
+  }
+  void operator()(const lanelet::ConstWeakArea & area) const
+  {
+    if (!area.expired()) {
+      push(ParameterKind::Area, area.lock().id(), false);
+    }
+  }
+
+private:
+  void push(const ParameterKind kind, const lanelet::Id id, const bool inverted) const
+  {
+    parameters_->push_back({role_, kind, id, inverted});
+  }
+
+  const std::string & role_;
+  std::vector<MapPatch::Parameter> * parameters_;
+};
+
+std::vector<MapPatch::Parameter> parameterRecords(
+  const lanelet::RegulatoryElement & regulatory_element)
+{
+  std::vector<MapPatch::Parameter> parameters;
+  for (const auto & role : regulatory_element.getParameters()) {
+    const ParameterRecorder recorder(role.first, &parameters);
+    for (const auto & parameter : role.second) {
+      boost::apply_visitor(recorder, parameter);
+    }
+  }
+  return parameters;
+}
+
+MapPatch::RegulatoryElement toRecord(const lanelet::RegulatoryElementConstPtr & regulatory_element)
+{
+  MapPatch::RegulatoryElement record;
+  record.id = regulatory_element->id();
+  record.parameters = parameterRecords(*regulatory_element);
+  record.attributes = regulatory_element->attributes();
+  return record;
+}
+
+template <typename PrimitiveT>
+lanelet::Id getIdOf(const PrimitiveT & primitive)
+{
+  return primitive.id();
+}
+
+lanelet::Id getIdOf(const lanelet::RegulatoryElementConstPtr & regulatory_element)
+{
+  return regulatory_element->id();
+}
+
+/// adds the records of every primitive of new_layer that is missing or different in old_layer
+template <typename LayerT, typename RecordT, typename ToRecord>
+void diffLayer(
+  const LayerT & old_layer, const LayerT & new_layer, const ToRecord & to_record,
+  std::vector<RecordT> * changed, std::vector<lanelet::Id> * removed)
+{
+  for (const auto & primitive : new_layer) {
+    auto record = to_record(primitive);
+    const auto old_it = old_layer.find(record.id);
+    if (old_it == old_layer.end() || !sameContent(to_record(*old_it), record)) {
+      changed->push_back(std::move(record));
+    }
+  }
+  for (const auto & primitive : old_layer) {
+    if (!new_layer.exists(getIdOf(primitive))) {
+      removed->push_back(getIdOf(primitive));
+    }
+  }
+}
+
+/// custom centerlines are not part of any layer, so they are compared through their lanelet
+struct CenterlineRecords
+{
+  MapPatch::LineString line_string;
+  std::vector<MapPatch::Point> points;  // only those missing in the point layer
+};
+
+std::optional<CenterlineRecords> centerlineRecords(
+  const lanelet::ConstLanelet & lanelet, const lanelet::LaneletMap & map)
+{
+  if (!lanelet.hasCustomCenterline()) {
+    return std::nullopt;
+  }
+  const auto centerline = lanelet.centerline();
+  if (map.lineStringLayer.exists(centerline.id())) {
+    return std::nullopt;
+  }
+  CenterlineRecords records;
+  records.line_string = toRecord(centerline, false);
+  for (const auto & point : centerline) {
+    if (!map.pointLayer.exists(point.id())) {
+      records.points.push_back(toRecord(point, false));
+    }
+  }
+  return records;
+}
+
+bool sameContent(
+  const std::optional<CenterlineRecords> & a, const std::optional<CenterlineRecords> & b)
+{
+  if (!a || !b) {
+    return !a && !b;
+  }
+  if (!sameContent(a->line_string, b->line_string) || a->points.size() != b->points.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a->points.size(); ++i) {
+    if (a->points[i].id != b->points[i].id || !sameContent(a->points[i], b->points[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * [PatchApplier updates the primitives of a map in place. Handles are resolved from the primitives
+ * created by the patch first and from the layers of the map otherwise]
+ */
+class PatchApplier
+{
+public:
+  PatchApplier(const MapPatch & patch, lanelet::LaneletMap * map) : patch_(patch), map_(map) {}
+
+  void apply()
+  {
+    // nothing is touched before every reference is known to resolve, so that a bad patch cannot
+    // leave the map half patched
+    validate();
+
+    reindex_ = !patch_.removed_points.empty() || !patch_.removed_line_strings.empty() ||
+               !patch_.removed_polygons.empty() || !patch_.removed_lanelets.empty() ||
+               !patch_.removed_areas.empty() || !patch_.removed_regulatory_elements.empty();
+
+    applyPoints();
+    applyLineStrings(
+      patch_.line_strings, map_->lineStringLayer, &line_strings_, &added_.line_strings,
+      &changed_line_strings_);
+    applyLineStrings(patch_.polygons, map_->polygonLayer, &polygons_, &added_.polygons, nullptr);
+    applyLanelets();
+    applyAreas();
+    applyRegulatoryElements();
+    attachRegulatoryElements();
+
+    if (reindex_) {
+      rebuildLayers();
+    } else {
+      addToLayers();
+    }
+    resetCenterlines();
+  }
+
+private:
+  template <typename RecordT>
+  static std::unordered_set<lanelet::Id> recordIds(const std::vector<RecordT> & records)
+  {
+    std::unordered_set<lanelet::Id> ids;
+    ids.reserve(records.size());
+    for (const auto & record : records) {
+      ids.insert(record.id);
+    }
+    return ids;
+  }
+
+  template <typename LayerT>
+  static void check(
+    const std::unordered_set<lanelet::Id> & patched, const LayerT & layer, const lanelet::Id id,
+    const char * kind)
+  {
+    if (patched.count(id) == 0 && !layer.exists(id)) {
+      throw std::runtime_error(
+        std::string("map patch refers to missing ") + kind + " " + std::to_string(id));
+    }
+  }
+
+  void validate() const
+  {
+    const auto points = recordIds(patch_.points);
+    const auto line_strings = recordIds(patch_.line_strings);
+    const auto polygons = recordIds(patch_.polygons);
+    const auto lanelets = recordIds(patch_.lanelets);
+    const auto areas = recordIds(patch_.areas);
+    const auto regulatory_elements = recordIds(patch_.regulatory_elements);
+
+    const auto check_line_strings = [&](const std::vector<MapPatch::Bound> & bounds) {
+      for (const auto & bound : bounds) {
+        check(line_strings, map_->lineStringLayer, bound.id, "linestring");
+      }
+    };
+    const auto check_regulatory_elements = [&](const std::vector<lanelet::Id> & ids) {
+      for (const auto id : ids) {
+        check(regulatory_elements, map_->regulatoryElementLayer, id, "regulatory element");
+      }
+    };
+
+    for (const auto * records : {&patch_.line_strings, &patch_.polygons}) {
+      for (const auto & record : *records) {
+        for (const auto id : record.points) {
+          check(points, map_->pointLayer, id, "point");
+        }
+      }
+    }
+    for (const auto & record : patch_.lanelets) {
+      check_line_strings({record.left, record.right});
+      if (
+        record.centerline != lanelet::InvalId && line_strings.count(record.centerline) == 0 &&
+        !map_->lineStringLayer.exists(record.centerline)) {
+        // an unchanged custom centerline is in no layer, see setCenterline
+        const auto it = map_->laneletLayer.find(record.id);
+        if (
+          it == map_->laneletLayer.end() || !it->hasCustomCenterline() ||
+          it->centerline().id() != record.centerline) {
+          throw std::runtime_error(
+            "map patch refers to missing centerline " + std::to_string(record.centerline));
+        }
+      }
+      check_regulatory_elements(record.regulatory_elements);
+    }
+    for (const auto & record : patch_.areas) {
+      check_line_strings(record.outer);
+      for (const auto & ring : record.inner) {
+        check_line_strings(ring);
+      }
+      check_regulatory_elements(record.regulatory_elements);
+    }
+    for (const auto & record : patch_.regulatory_elements) {
+      for (const auto & parameter : record.parameters) {
+        switch (parameter.kind) {
+          case ParameterKind::Point:
+            check(points, map_->pointLayer, parameter.id, "point");
+            break;
+          case ParameterKind::LineString:
+            check(line_strings, map_->lineStringLayer, parameter.id, "linestring");
+            break;
+          case ParameterKind::Polygon:
+            check(polygons, map_->polygonLayer, parameter.id, "polygon");
+            break;
+          case ParameterKind::Lanelet:
+            check(lanelets, map_->laneletLayer, parameter.id, "lanelet");
+            break;
+          case ParameterKind::Area:
+            check(areas, map_->areaLayer, parameter.id, "area");
+            break;
+          default:
+            throw std::runtime_error("map patch has an unknown regulatory element parameter kind");
+        }
+      }
+    }
+  }
+
+  /**
+   * [resetCenterlines drops the centerlines lanelet2 computed from bounds whose points were moved
+   * or replaced in place. Lanelets whose bounds were set anew are reset by lanelet2 itself]
+   */
+  void resetCenterlines()
+  {
+    if (moved_points_.empty() && changed_line_strings_.empty()) {
+      return;
+    }
+    std::unordered_set<lanelet::Id> line_string_ids;
+    lanelet::LineStrings3d line_strings;
+    const auto add = [&](const lanelet::LineString3d & line_string) {
+      if (line_string_ids.insert(line_string.id()).second) {
+        line_strings.push_back(line_string);
+      }
+    };
+    for (const auto id : changed_line_strings_) {
+      const auto it = map_->lineStringLayer.find(id);
+      if (it != map_->lineStringLayer.end()) {
+        add(*it);
+      }
+    }
+    for (const auto id : moved_points_) {
+      const auto it = map_->pointLayer.find(id);
+      if (it == map_->pointLayer.end()) {
+        continue;
+      }
+      for (const auto & line_string : map_->lineStringLayer.findUsages(*it)) {
+        add(line_string);
+      }
+    }
+    for (const auto & line_string : line_strings) {
+      for (auto & lanelet : map_->laneletLayer.findUsages(line_string)) {
+        // a custom centerline is no cache and must be kept
+        if (!lanelet.hasCustomCenterline()) {
+          lanelet.resetCache();
+        }
+      }
+    }
+  }
+
+  lanelet::Point3d point(const lanelet::Id id)
+  {
+    const auto it = points_.find(id);
+    if (it != points_.end()) {
+      return it->second;
+    }
+    return get(map_->pointLayer, id, "point");
+  }
+
+  lanelet::LineString3d lineString(const MapPatch::Bound & bound)
+  {
+    const auto it = line_strings_.find(bound.id);
+    const auto line_string = it != line_strings_.end()
+                               ? it->second
+                               : get(map_->lineStringLayer, bound.id, "linestring");
+    return bound.inverted ? line_string.invert() : line_string;
+  }
+
+  lanelet::Polygon3d polygon(const MapPatch::Bound & bound)
+  {
+    const auto it = polygons_.find(bound.id);
+    const auto polygon =
+      it != polygons_.end() ? it->second : get(map_->polygonLayer, bound.id, "polygon");
+    return bound.inverted ? polygon.invert() : polygon;
+  }
+
+  lanelet::Lanelet lanelet(const lanelet::Id id)
+  {
+    const auto it = lanelets_.find(id);
+    return it != lanelets_.end() ? it->second : get(map_->laneletLayer, id, "lanelet");
+  }
+
+  lanelet::Area area(const lanelet::Id id)
+  {
+    const auto it = areas_.find(id);
+    return it != areas_.end() ? it->second : get(map_->areaLayer, id, "area");
+  }
+
+  lanelet::RegulatoryElementPtr regulatoryElement(const lanelet::Id id)
+  {
+    const auto it = regulatory_elements_.find(id);
+    return it != regulatory_elements_.end()
+             ? it->second
+             : get(map_->regulatoryElementLayer, id, "regulatory element");
+  }
+
+  template <typename LayerT>
+  static auto get(LayerT & layer, const lanelet::Id id, const char * kind)
+  {
+    const auto it = layer.find(id);
+    if (it == layer.end()) {
+      throw std::runtime_error(
+        std::string("map patch refers to missing ") + kind + " " + std::to_string(id));
+    }
+    return *it;
+  }
+
+  lanelet::LineStrings3d lineStrings(const std::vector<MapPatch::Bound> & bounds)
+  {
+    lanelet::LineStrings3d line_strings;
+    line_strings.reserve(bounds.size());
+    for (const auto & bound : bounds) {
+      line_strings.push_back(lineString(bound));
+    }
+    return line_strings;
+  }
+
+  lanelet::InnerBounds innerBounds(const std::vector<std::vector<MapPatch::Bound>> & rings)
+  {
+    lanelet::InnerBounds inner_bounds;
+    inner_bounds.reserve(rings.size());
+    for (const auto & ring : rings) {
+      inner_bounds.push_back(lineStrings(ring));
+    }
+    return inner_bounds;
+  }
+
+  void applyPoints()
+  {
+    for (const auto & record : patch_.points) {
+      if (record.in_layer && map_->pointLayer.exists(record.id)) {
+        auto point = map_->pointLayer.get(record.id);
+        if (point.x() != record.x || point.y() != record.y || point.z() != record.z) {
+          point.x() = record.x;
+          point.y() = record.y;
+          point.z() = record.z;
+          moved_points_.push_back(record.id);
+          reindex_ = true;
+        }
+        point.attributes() = record.attributes;
+        points_.emplace(record.id, point);
+        continue;
+      }
+      const lanelet::Point3d point(record.id, record.x, record.y, record.z, record.attributes);
+      points_.emplace(record.id, point);
+      if (record.in_layer) {
+        added_.points.push_back(point);
+      }
+    }
+  }
+
+  template <typename PrimitiveT, typename LayerT>
+  void applyLineStrings(
+    const std::vector<MapPatch::LineString> & records, LayerT & layer,
+    std::unordered_map<lanelet::Id, PrimitiveT> * resolved, std::vector<PrimitiveT> * added,
+    std::vector<lanelet::Id> * changed)
+  {
+    for (const auto & record : records) {
+      if (record.in_layer && layer.exists(record.id)) {
+        auto primitive = layer.get(record.id);
+        if (toRecord(primitive, true).points != record.points) {
+          primitive.clear();
+          for (const auto id : record.points) {
+            primitive.push_back(point(id));
+          }
+          if (changed != nullptr) {
+            changed->push_back(record.id);
+          }
+          reindex_ = true;
+        }
+        primitive.attributes() = record.attributes;
+        resolved->emplace(record.id, primitive);
+        continue;
+      }
+      lanelet::Points3d points;
+      points.reserve(record.points.size());
+      for (const auto id : record.points) {
+        points.push_back(point(id));
+      }
+      const PrimitiveT primitive(record.id, points, record.attributes);
+      resolved->emplace(record.id, primitive);
+      if (record.in_layer) {
+        added->push_back(primitive);
+      }
+    }
+  }
+
+  void applyLanelets()
+  {
+    for (const auto & record : patch_.lanelets) {
+      const auto left = lineString(record.left);
+      const auto right = lineString(record.right);
+      if (map_->laneletLayer.exists(record.id)) {
+        auto lanelet = map_->laneletLayer.get(record.id);
+        const auto current = toRecord(lanelet);
+        if (record.centerline == lanelet::InvalId && current.centerline != lanelet::InvalId) {
+          // lanelet2 cannot drop a custom centerline, so the lanelet is replaced
+          lanelet = lanelet::Lanelet(record.id, left, right, record.attributes);
+          replaced_lanelets_.push_back(lanelet);
+          reindex_ = true;
+        } else {
+          if (current.left != record.left) {
+            lanelet.setLeftBound(left);
+            reindex_ = true;
+          }
+          if (current.right != record.right) {
+            lanelet.setRightBound(right);
+            reindex_ = true;
+          }
+          lanelet.attributes() = record.attributes;
+        }
+        setCenterline(record, &lanelet);
+        lanelets_.emplace(record.id, lanelet);
+        continue;
+      }
+      lanelet::Lanelet lanelet(record.id, left, right, record.attributes);
+      setCenterline(record, &lanelet);
+      lanelets_.emplace(record.id, lanelet);
+      added_.lanelets.push_back(lanelet);
+    }
+  }
+
+  void setCenterline(const MapPatch::Lanelet & record, lanelet::Lanelet * lanelet)
+  {
+    if (record.centerline == lanelet::InvalId) {
+      return;
+    }
+    // an unchanged centerline is neither in the patch nor in a layer, keep the current one
+    const bool stored = line_strings_.count(record.centerline) > 0 ||
+                        map_->lineStringLayer.exists(record.centerline);
+    if (!stored && lanelet->hasCustomCenterline() &&
+        lanelet->centerline().id() == record.centerline) {
+      return;
+    }
+    lanelet->setCenterline(lineString({record.centerline, false}));
+  }
+
+  void applyAreas()
+  {
+    for (const auto & record : patch_.areas) {
+      auto outer = lineStrings(record.outer);
+      auto inner = innerBounds(record.inner);
+      if (map_->areaLayer.exists(record.id)) {
+        auto area = map_->areaLayer.get(record.id);
+        const auto current = toRecord(area);
+        if (current.outer != record.outer) {
+          area.setOuterBound(outer);
+          reindex_ = true;
+        }
+        if (current.inner != record.inner) {
+          area.setInnerBounds(inner);
+          reindex_ = true;
+        }
+        area.attributes() = record.attributes;
+        areas_.emplace(record.id, area);
+        continue;
+      }
+      const lanelet::Area area(record.id, outer, inner, record.attributes);
+      areas_.emplace(record.id, area);
+      added_.areas.push_back(area);
+    }
+  }
+
+  lanelet::RuleParameter parameter(const MapPatch::Parameter & parameter)
+  {
+    switch (parameter.kind) {
+      case ParameterKind::Point:
+        return point(parameter.id);
+      case ParameterKind::LineString:
+        return lineString({parameter.id, parameter.inverted});
+      case ParameterKind::Polygon:
+        return polygon({parameter.id, parameter.inverted});
+      case ParameterKind::Lanelet:
+        return lanelet::WeakLanelet(lanelet(parameter.id));
+      case ParameterKind::Area:
+        return lanelet::WeakArea(area(parameter.id));
+      default:
+        throw std::runtime_error("map patch has an unknown regulatory element parameter kind");
+    }
+  }
+
+  lanelet::RegulatoryElementPtr create(const MapPatch::RegulatoryElement & record)
+  {
+    lanelet::RuleParameterMap parameters;
+    for (const auto & p : record.parameters) {
+      parameters[p.role].push_back(parameter(p));
+    }
+    const auto subtype = record.attributes.find(lanelet::AttributeName::Subtype);
+    if (subtype != record.attributes.end()) {
+      try {
+        return lanelet::RegulatoryElementFactory::create(
+          subtype->second.value(), record.id, parameters, record.attributes);
+      } catch (const lanelet::InvalidInputError &) {
+        // unknown rule, keep it generic like the osm parser does
+      }
+    }
+    return std::make_shared<lanelet::GenericRegulatoryElement>(
+      record.id, parameters, record.attributes);
+  }
+
+  void applyRegulatoryElements()
+  {
+    for (const auto & record : patch_.regulatory_elements) {
+      const auto it = map_->regulatoryElementLayer.find(record.id);
+      if (it != map_->regulatoryElementLayer.end()) {
+        const auto & current = *it;
+        if (parameterRecords(*current) == record.parameters) {
+          current->attributes() = record.attributes;
+          regulatory_elements_.emplace(record.id, current);
+          continue;
+        }
+        // parameters are fixed by the rule constructors, so a changed element is replaced and its
+        // users are pointed to the new one
+        const auto replacement = create(record);
+        regulatory_elements_.emplace(record.id, replacement);
+        replaced_regulatory_elements_.emplace_back(current, replacement);
+        reindex_ = true;
+        continue;
+      }
+      const auto regulatory_element = create(record);
+      regulatory_elements_.emplace(record.id, regulatory_element);
+      added_.regulatory_elements.push_back(regulatory_element);
+    }
+  }
+
+  template <typename PrimitiveT>
+  static void replaceRegulatoryElement(
+    PrimitiveT primitive, const lanelet::RegulatoryElementPtr & old_element,
+    const lanelet::RegulatoryElementPtr & new_element)
+  {
+    primitive.removeRegulatoryElement(old_element);
+    primitive.addRegulatoryElement(new_element);
+  }
+
+  template <typename PrimitiveT>
+  void syncRegulatoryElements(
+    PrimitiveT primitive, const std::vector<lanelet::Id> & ids, const bool in_map)
+  {
+    if (regulatoryElementIds(primitive) == ids) {
+      return;
+    }
+    const auto current = primitive.regulatoryElements();
+    for (const auto & regulatory_element : current) {
+      primitive.removeRegulatoryElement(regulatory_element);
+    }
+    for (const auto id : ids) {
+      primitive.addRegulatoryElement(regulatoryElement(id));
+    }
+    // the usage tables of the layers are only updated on insertion
+    reindex_ = reindex_ || in_map;
+  }
+
+  void attachRegulatoryElements()
+  {
+    for (const auto & [old_element, new_element] : replaced_regulatory_elements_) {
+      for (auto & lanelet : map_->laneletLayer.findUsages(old_element)) {
+        replaceRegulatoryElement(lanelet, old_element, new_element);
+      }
+      for (auto & area : map_->areaLayer.findUsages(old_element)) {
+        replaceRegulatoryElement(area, old_element, new_element);
+      }
+    }
+    for (const auto & record : patch_.lanelets) {
+      syncRegulatoryElements(
+        lanelets_.at(record.id), record.regulatory_elements,
+        map_->laneletLayer.exists(record.id));
+    }
+    for (const auto & record : patch_.areas) {
+      syncRegulatoryElements(
+        areas_.at(record.id), record.regulatory_elements, map_->areaLayer.exists(record.id));
+    }
+  }
+
+  void addToLayers()
+  {
+    for (const auto & point : added_.points) {
+      map_->add(point);
+    }
+    for (const auto & line_string : added_.line_strings) {
+      map_->add(line_string);
+    }
+    for (const auto & polygon : added_.polygons) {
+      map_->add(polygon);
+    }
+    for (const auto & lanelet : added_.lanelets) {
+      map_->add(lanelet);
+    }
+    for (const auto & area : added_.areas) {
+      map_->add(area);
+    }
+    for (const auto & regulatory_element : added_.regulatory_elements) {
+      map_->add(regulatory_element);
+    }
+  }
+
+  template <typename LayerT, typename T>
+  static std::unordered_map<lanelet::Id, T> layerMap(
+    LayerT & layer, const std::vector<lanelet::Id> & removed, const std::vector<T> & added)
+  {
+    const std::unordered_set<lanelet::Id> removed_ids(removed.begin(), removed.end());
+    std::unordered_map<lanelet::Id, T> primitives;
+    primitives.reserve(layer.size() + added.size());
+    for (const auto & primitive : layer) {
+      const auto id = getIdOf(primitive);
+      if (removed_ids.count(id) == 0) {
+        primitives.emplace(id, primitive);
+      }
+    }
+    for (const auto & primitive : added) {
+      primitives.insert_or_assign(getIdOf(primitive), primitive);
+    }
+    return primitives;
+  }
+
+  void rebuildLayers()
+  {
+    for (const auto & replaced : replaced_regulatory_elements_) {
+      added_.regulatory_elements.push_back(replaced.second);
+    }
+    added_.lanelets.insert(
+      added_.lanelets.end(), replaced_lanelets_.begin(), replaced_lanelets_.end());
+
+    *map_ = lanelet::LaneletMap(
+      layerMap(map_->laneletLayer, patch_.removed_lanelets, added_.lanelets),
+      layerMap(map_->areaLayer, patch_.removed_areas, added_.areas),
+      layerMap(
+        map_->regulatoryElementLayer, patch_.removed_regulatory_elements,
+        added_.regulatory_elements),
+      layerMap(map_->polygonLayer, patch_.removed_polygons, added_.polygons),
+      layerMap(map_->lineStringLayer, patch_.removed_line_strings, added_.line_strings),
+      layerMap(map_->pointLayer, patch_.removed_points, added_.points));
+  }
+
+  struct Added
+  {
+    lanelet::Points3d points;
+    lanelet::LineStrings3d line_strings;
+    lanelet::Polygons3d polygons;
+    lanelet::Lanelets lanelets;
+    lanelet::Areas areas;
+    lanelet::RegulatoryElementPtrs regulatory_elements;
+  };
+
+  const MapPatch & patch_;
+  lanelet::LaneletMap * map_;
+  bool reindex_{false};
+
+  std::unordered_map<lanelet::Id, lanelet::Point3d> points_;
+  std::unordered_map<lanelet::Id, lanelet::LineString3d> line_strings_;
+  std::unordered_map<lanelet::Id, lanelet::Polygon3d> polygons_;
+  std::unordered_map<lanelet::Id, lanelet::Lanelet> lanelets_;
+  std::unordered_map<lanelet::Id, lanelet::Area> areas_;
+  std::unordered_map<lanelet::Id, lanelet::RegulatoryElementPtr> regulatory_elements_;
+
+  Added added_;
+  std::vector<lanelet::Id> moved_points_;
+  std::vector<lanelet::Id> changed_line_strings_;  // in-layer linestrings with other points
+  lanelet::Lanelets replaced_lanelets_;
+  std::vector<std::pair<lanelet::RegulatoryElementPtr, lanelet::RegulatoryElementPtr>>
+    replaced_regulatory_elements_;
+};
+
+void saveAttributes(boost::archive::binary_oarchive & oa, const lanelet::AttributeMap & attributes)
+{
+  const std::uint64_t count = attributes.size();
+  oa << count;
+  for (const auto & attribute : attributes) {
+    oa << attribute.first << attribute.second.value();
+  }
+}
+
+void loadAttributes(boost::archive::binary_iarchive & ia, lanelet::AttributeMap * attributes)
+{
+  std::uint64_t count = 0;
+  ia >> count;
+  for (std::uint64_t i = 0; i < count; ++i) {
+    std::string key;
+    std::string value;
+    ia >> key >> value;
+    (*attributes)[key] = value;
+  }
+}
+
+void saveBounds(boost::archive::binary_oarchive & oa, const std::vector<MapPatch::Bound> & bounds)
+{
+  const std::uint64_t count = bounds.size();
+  oa << count;
+  for (const auto & bound : bounds) {
+    oa << bound.id << bound.inverted;
+  }
+}
+
+void loadBounds(boost::archive::binary_iarchive & ia, std::vector<MapPatch::Bound> * bounds)
+{
+  std::uint64_t count = 0;
+  ia >> count;
+  bounds->resize(count);
+  for (auto & bound : *bounds) {
+    ia >> bound.id >> bound.inverted;
+  }
+}
+
+void saveIds(boost::archive::binary_oarchive & oa, const std::vector<lanelet::Id> & ids)
+{
+  const std::uint64_t count = ids.size();
+  oa << count;
+  for (const auto id : ids) {
+    oa << id;
+  }
+}
+
+void loadIds(boost::archive::binary_iarchive & ia, std::vector<lanelet::Id> * ids)
+{
+  std::uint64_t count = 0;
+  ia >> count;
+  ids->resize(count);
+  for (auto & id : *ids) {
+    ia >> id;
+  }
+}
+
+void saveLineStrings(
+  boost::archive::binary_oarchive & oa, const std::vector<MapPatch::LineString> & records)
+{
+  const std::uint64_t count = records.size();
+  oa << count;
+  for (const auto & record : records) {
+    oa << record.id << record.in_layer;
+    saveIds(oa, record.points);
+    saveAttributes(oa, record.attributes);
+  }
+}
+
+void loadLineStrings(
+  boost::archive::binary_iarchive & ia, std::vector<MapPatch::LineString> * records)
+{
+  std::uint64_t count = 0;
+  ia >> count;
+  records->resize(count);
+  for (auto & record : *records) {
+    ia >> record.id >> record.in_layer;
+    loadIds(ia, &record.points);
+    loadAttributes(ia, &record.attributes);
+  }
+}
+
+void savePatch(boost::archive::binary_oarchive & oa, const MapPatch & patch)
+{
+  oa << map_patch_format_version << patch.id_counter << patch.fingerprint;
+
+  std::uint64_t count = patch.points.size();
+  oa << count;
+  for (const auto & record : patch.points) {
+    oa << record.id << record.x << record.y << record.z << record.in_layer;
+    saveAttributes(oa, record.attributes);
+  }
+  saveLineStrings(oa, patch.line_strings);
+  saveLineStrings(oa, patch.polygons);
+
+  count = patch.lanelets.size();
+  oa << count;
+  for (const auto & record : patch.lanelets) {
+    oa << record.id << record.left.id << record.left.inverted << record.right.id
+       << record.right.inverted << record.centerline;
+    saveIds(oa, record.regulatory_elements);
+    saveAttributes(oa, record.attributes);
+  }
+
+  count = patch.areas.size();
+  oa << count;
+  for (const auto & record : patch.areas) {
+    oa << record.id;
+    saveBounds(oa, record.outer);
+    const std::uint64_t ring_count = record.inner.size();
+    oa << ring_count;
+    for (const auto & ring : record.inner) {
+      saveBounds(oa, ring);
+    }
+    saveIds(oa, record.regulatory_elements);
+    saveAttributes(oa, record.attributes);
+  }
+
+  count = patch.regulatory_elements.size();
+  oa << count;
+  for (const auto & record : patch.regulatory_elements) {
+    oa << record.id;
+    const std::uint64_t parameter_count = record.parameters.size();
+    oa << parameter_count;
+    for (const auto & parameter : record.parameters) {
+      const auto kind = static_cast<std::uint32_t>(parameter.kind);
+      oa << parameter.role << kind << parameter.id << parameter.inverted;
+    }
+    saveAttributes(oa, record.attributes);
+  }
+
+  saveIds(oa, patch.removed_points);
+  saveIds(oa, patch.removed_line_strings);
+  saveIds(oa, patch.removed_polygons);
+  saveIds(oa, patch.removed_lanelets);
+  saveIds(oa, patch.removed_areas);
+  saveIds(oa, patch.removed_regulatory_elements);
+}
+
+void loadPatch(boost::archive::binary_iarchive & ia, MapPatch * patch)
+{
+  std::uint32_t version = 0;
+  ia >> version;
+  if (version != map_patch_format_version) {
+    throw std::runtime_error("unsupported map patch version " + std::to_string(version));
+  }
+  ia >> patch->id_counter >> patch->fingerprint;
+
+  std::uint64_t count = 0;
+  ia >> count;
+  patch->points.resize(count);
+  for (auto & record : patch->points) {
+    ia >> record.id >> record.x >> record.y >> record.z >> record.in_layer;
+    loadAttributes(ia, &record.attributes);
+  }
+  loadLineStrings(ia, &patch->line_strings);
+  loadLineStrings(ia, &patch->polygons);
+
+  ia >> count;
+  patch->lanelets.resize(count);
+  for (auto & record : patch->lanelets) {
+    ia >> record.id >> record.left.id >> record.left.inverted >> record.right.id >>
+      record.right.inverted >> record.centerline;
+    loadIds(ia, &record.regulatory_elements);
+    loadAttributes(ia, &record.attributes);
+  }
+
+  ia >> count;
+  patch->areas.resize(count);
+  for (auto & record : patch->areas) {
+    ia >> record.id;
+    loadBounds(ia, &record.outer);
+    std::uint64_t ring_count = 0;
+    ia >> ring_count;
+    record.inner.resize(ring_count);
+    for (auto & ring : record.inner) {
+      loadBounds(ia, &ring);
+    }
+    loadIds(ia, &record.regulatory_elements);
+    loadAttributes(ia, &record.attributes);
+  }
+
+  ia >> count;
+  patch->regulatory_elements.resize(count);
+  for (auto & record : patch->regulatory_elements) {
+    ia >> record.id;
+    std::uint64_t parameter_count = 0;
+    ia >> parameter_count;
+    record.parameters.resize(parameter_count);
+    for (auto & parameter : record.parameters) {
+      std::uint32_t kind = 0;
+      ia >> parameter.role >> kind >> parameter.id >> parameter.inverted;
+      parameter.kind = static_cast<ParameterKind>(kind);
+    }
+    loadAttributes(ia, &record.attributes);
+  }
+
+  loadIds(ia, &patch->removed_points);
+  loadIds(ia, &patch->removed_line_strings);
+  loadIds(ia, &patch->removed_polygons);
+  loadIds(ia, &patch->removed_lanelets);
+  loadIds(ia, &patch->removed_areas);
+  loadIds(ia, &patch->removed_regulatory_elements);
+}
+}  // namespace
+
+bool MapPatch::empty() const
+{
+  return points.empty() && line_strings.empty() && polygons.empty() && lanelets.empty() &&
+         areas.empty() && regulatory_elements.empty() && removed_points.empty() &&
+         removed_line_strings.empty() && removed_polygons.empty() && removed_lanelets.empty() &&
+         removed_areas.empty() && removed_regulatory_elements.empty();
+}
+
+MapPatch computeMapPatch(const lanelet::LaneletMap & old_map, const lanelet::LaneletMap & new_map)
+{
+  MapPatch patch;
+  diffLayer(
+    old_map.pointLayer, new_map.pointLayer,
+    [](const lanelet::ConstPoint3d & point) { return toRecord(point, true); }, &patch.points,
+    &patch.removed_points);
+  diffLayer(
+    old_map.lineStringLayer, new_map.lineStringLayer,
+    [](const lanelet::ConstLineString3d & line_string) { return toRecord(line_string, true); },
+    &patch.line_strings, &patch.removed_line_strings);
+  diffLayer(
+    old_map.polygonLayer, new_map.polygonLayer,
+    [](const lanelet::ConstPolygon3d & polygon) { return toRecord(polygon, true); },
+    &patch.polygons, &patch.removed_polygons);
+  diffLayer(
+    old_map.areaLayer, new_map.areaLayer,
+    [](const lanelet::ConstArea & area) { return toRecord(area); }, &patch.areas,
+    &patch.removed_areas);
+  diffLayer(
+    old_map.regulatoryElementLayer, new_map.regulatoryElementLayer,
+    [](const lanelet::RegulatoryElementConstPtr & regulatory_element) {
+      return toRecord(regulatory_element);
+    },
+    &patch.regulatory_elements, &patch.removed_regulatory_elements);
+
+  // lanelets are compared together with their custom centerline
+  std::unordered_set<lanelet::Id> centerline_ids;
+  for (const auto & lanelet : new_map.laneletLayer) {
+    const auto record = toRecord(lanelet);
+    const auto centerline = centerlineRecords(lanelet, new_map);
+    const auto old_it = old_map.laneletLayer.find(lanelet.id());
+    if (
+      old_it != old_map.laneletLayer.end() && sameContent(toRecord(*old_it), record) &&
+      sameContent(centerlineRecords(*old_it, old_map), centerline)) {
+      continue;
+    }
+    patch.lanelets.push_back(record);
+    if (centerline && centerline_ids.insert(centerline->line_string.id).second) {
+      patch.line_strings.push_back(centerline->line_string);
+      patch.points.insert(patch.points.end(), centerline->points.begin(), centerline->points.end());
+    }
+  }
+  for (const auto & lanelet : old_map.laneletLayer) {
+    if (!new_map.laneletLayer.exists(lanelet.id())) {
+      patch.removed_lanelets.push_back(lanelet.id());
+    }
+  }
+
+  patch.id_counter = lanelet::utils::getId();
+  patch.base_fingerprint = conversion::computeFingerprint(old_map);
+  patch.fingerprint = conversion::computeFingerprint(new_map);
+  return patch;
+}
+
+void applyMapPatch(
+  const MapPatch & patch, const lanelet::LaneletMapPtr & map, const std::uint64_t map_fingerprint)
+{
+  if (!map) {
+    std::cerr << __FUNCTION__ << ": map is null pointer!" << std::endl;
+    return;
+  }
+  // hashing the map here would make every patch cost O(map), the caller knows its fingerprint
+  if (
+    map_fingerprint != 0 && patch.base_fingerprint != 0 &&
+    patch.base_fingerprint != map_fingerprint) {
+    throw std::runtime_error("map patch was computed against another version of the map");
+  }
+  PatchApplier(patch, map.get()).apply();
+  lanelet::utils::registerId(patch.id_counter);
+}
+
+namespace conversion
+{
+void toPatchMsg(
+  const MapPatch & patch, autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgCompression compression)
+{
+  if (msg == nullptr) {
+    std::cerr << __FUNCTION__ << ": msg is null pointer!" << std::endl;
+    return;
+  }
+
+  std::vector<std::uint8_t> raw;
+  {
+    impl::ByteVectorOutputBuffer buffer(raw);
+    boost::archive::binary_oarchive oa(buffer);
+    savePatch(oa, patch);
+  }
+  impl::BinMsgHeader header;
+  header.compression = compression;
+  header.flags = impl::BinMsgFlag::Patch;
+  // a patch carries the fingerprint of the map it applies to, not of a map of its own
+  header.fingerprint = patch.base_fingerprint;
+  impl::writeEncodedPayload(raw, header, &msg->data);
+}
+
+bool isPatchMsg(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  if (!impl::hasBinMsgHeader(msg.data.data(), msg.data.size())) {
+    return false;
+  }
+  const auto header = impl::readBinMsgHeader(msg.data.data(), msg.data.size());
+  return (header.flags & impl::BinMsgFlag::Patch) != 0;
+}
+
+void fromPatchMsg(const autoware_map_msgs::msg::LaneletMapBin & msg, MapPatch * patch)
+{
+  if (patch == nullptr) {
+    std::cerr << __FUNCTION__ << ": patch is null pointer!" << std::endl;
+    return;
+  }
+  if (!isPatchMsg(msg)) {
+    throw std::runtime_error("LaneletMapBin payload is not a map patch");
+  }
+
+  impl::BinMsgHeader header;
+  const auto raw = impl::readEncodedPayload(msg.data, &header);
+  impl::ByteArrayInputBuffer buffer(raw.data(), raw.size());
+  try {
+    boost::archive::binary_iarchive ia(buffer);
+    *patch = MapPatch();
+    loadPatch(ia, patch);
+    patch->base_fingerprint = header.fingerprint;
+  } catch (const boost::archive::archive_exception & e) {
+    throw std::runtime_error(std::string("malformed map patch: ") + e.what());
+  }
+}
+
+void applyPatchMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, const lanelet::LaneletMapPtr & map,
+  const std::uint64_t map_fingerprint)
+{
+  MapPatch patch;
+  fromPatchMsg(msg, &patch);
+  applyMapPatch(patch, map, map_fingerprint);
+}
+}  // namespace conversion
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
@@ -19,11 +19,9 @@
 #include "autoware_lanelet2_extension/utility/message_conversion.hpp"
 
 #include "autoware_lanelet2_extension/projection/mgrs_projector.hpp"
+#include "bin_msg_codec.hpp"
 #include "deprecated.hpp"
 
-#include <boost/archive/binary_iarchive.hpp>
-#include <boost/archive/binary_oarchive.hpp>
-
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_io/Exceptions.h>
@@ -32,11 +30,12 @@
 #include <lanelet2_io/io_handlers/OsmHandler.h>
 #include <lanelet2_io/io_handlers/Serialize.h>
 #include <lanelet2_projection/UTM.h>
+#include <lanelet2_routing/RoutingCost.h>
 #include <lanelet2_routing/RoutingGraph.h>
 
 #include <iostream>
 #include <memory>
-#include <sstream>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -49,15 +48,7 @@ void fromBinMsg(const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::Lane
     return;
   }
 
-  std::string data_str;
-  data_str.assign(msg.data.begin(), msg.data.end());
-
-  std::stringstream ss;
-  ss << data_str;
-  boost::archive::binary_iarchive oa(ss);
-  oa >> *map;
-  lanelet::Id id_counter = 0;
-  oa >> id_counter;
+  const auto id_counter = lanelet::utils::conversion::impl::readMapPayload(msg.data, map.get());
   lanelet::utils::registerId(id_counter);
 }
 
@@ -66,10 +57,9 @@ void fromBinMsg(
   lanelet::traffic_rules::TrafficRulesPtr * traffic_rules,
   lanelet::routing::RoutingGraphPtr * routing_graph)
 {
-  fromBinMsg(msg, map);
   *traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  *routing_graph = lanelet::routing::RoutingGraph::build(*map, **traffic_rules);
+  lanelet::utils::conversion::fromBinMsg(msg, map, *traffic_rules, routing_graph);
 }
 }  // namespace deprecated
 
@@ -82,16 +72,49 @@ void toBinMsg(const lanelet::LaneletMapPtr & map, autoware_map_msgs::msg::Lanele
     return;
   }
 
-  std::stringstream ss;
-  boost::archive::binary_oarchive oa(ss);
-  oa << *map;
-  auto id_counter = lanelet::utils::getId();
-  oa << id_counter;
+  impl::writeMapPayload(*map, BinMsgCompression::None, &msg->data);
+}
+
+void toBinMsg(
+  const lanelet::LaneletMapPtr & map, autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgCompression compression)
+{
+  if (msg == nullptr) {
+    std::cerr << __FUNCTION__ << "msg is null pointer!";
+    return;
+  }
+
+  impl::writeMapPayload(*map, compression, &msg->data);
+}
+
+void toBinMsg(
+  const lanelet::LaneletMapPtr & map, autoware_map_msgs::msg::LaneletMapBin * msg,
+  const BinMsgFormat format, const BinMsgCompression compression)
+{
+  if (msg == nullptr) {
+    std::cerr << __FUNCTION__ << "msg is null pointer!";
+    return;
+  }
+
+  impl::writeMapPayload(*map, compression, &msg->data, nullptr, format);
+}
 
-  std::string data_str(ss.str());
+void toBinMsg(
+  const lanelet::LaneletMapPtr & map, const lanelet::routing::RoutingGraphConstPtr & routing_graph,
+  const lanelet::traffic_rules::TrafficRules & traffic_rules,
+  autoware_map_msgs::msg::LaneletMapBin * msg, const BinMsgCompression compression)
+{
+  if (msg == nullptr) {
+    std::cerr << __FUNCTION__ << "msg is null pointer!";
+    return;
+  }
+  if (!routing_graph) {
+    impl::writeMapPayload(*map, compression, &msg->data);
+    return;
+  }
 
-  msg->data.clear();
-  msg->data.assign(data_str.begin(), data_str.end());
+  const auto section = impl::captureRoutingGraph(*map, *routing_graph, traffic_rules);
+  impl::writeMapPayload(*map, compression, &msg->data, &section);
 }
 
 void fromBinMsg(const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map)
@@ -101,28 +124,61 @@ void fromBinMsg(const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::Lane
     return;
   }
 
-  std::string data_str;
-  data_str.assign(msg.data.begin(), msg.data.end());
-
-  std::stringstream ss;
-  ss << data_str;
-  boost::archive::binary_iarchive oa(ss);
-  oa >> *map;
-  lanelet::Id id_counter = 0;
-  oa >> id_counter;
+  const auto id_counter = impl::readMapPayload(msg.data, map.get());
   lanelet::utils::registerId(id_counter);
   // *map = std::move(laneletMap);
 }
 
+void fromBinMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
+  const std::uint32_t layers)
+{
+  if (!map) {
+    std::cerr << __FUNCTION__ << ": map is null pointer!";
+    return;
+  }
+
+  const auto id_counter = impl::readMapPayload(msg.data, map.get(), nullptr, layers);
+  lanelet::utils::registerId(id_counter);
+}
+
 void fromBinMsg(
   const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
   lanelet::traffic_rules::TrafficRulesPtr * traffic_rules,
   lanelet::routing::RoutingGraphPtr * routing_graph)
 {
-  deprecated::fromBinMsg(msg, map);
-  *traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  *routing_graph = lanelet::routing::RoutingGraph::build(*map, **traffic_rules);
+  deprecated::fromBinMsg(msg, map, traffic_rules, routing_graph);
+}
+
+void fromBinMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
+  const lanelet::traffic_rules::TrafficRulesPtr & traffic_rules,
+  lanelet::routing::RoutingGraphPtr * routing_graph)
+{
+  fromBinMsg(msg, map, traffic_rules, lanelet::routing::defaultRoutingCosts(), routing_graph);
+}
+
+void fromBinMsg(
+  const autoware_map_msgs::msg::LaneletMapBin & msg, lanelet::LaneletMapPtr map,
+  const lanelet::traffic_rules::TrafficRulesPtr & traffic_rules,
+  const lanelet::routing::RoutingCostPtrs & routing_costs,
+  lanelet::routing::RoutingGraphPtr * routing_graph)
+{
+  if (!map) {
+    std::cerr << __FUNCTION__ << ": map is null pointer!";
+    return;
+  }
+  if (!traffic_rules || routing_graph == nullptr) {
+    std::cerr << __FUNCTION__ << ": traffic_rules or routing_graph is null pointer!";
+    return;
+  }
+
+  std::optional<impl::RoutingGraphSection> section;
+  const auto id_counter = impl::readMapPayload(msg.data, map.get(), &section);
+  lanelet::utils::registerId(id_counter);
+  // the map was fingerprinted by the publisher, hashing it again would cost as much as decoding it
+  *routing_graph = impl::restoreOrBuildRoutingGraph(
+    *map, *traffic_rules, routing_costs, section, peekFingerprint(msg).value_or(0));
 }
 
 void toGeomMsgPt(const geometry_msgs::msg::Point32 & src, geometry_msgs::msg::Point * dst)
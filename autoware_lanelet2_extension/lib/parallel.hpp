@@ -0,0 +1,97 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__LIB__PARALLEL_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__LIB__PARALLEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lanelet::utils::impl
+{
+/**
+ * [parallelFor calls fn(i) for every i in [0, size). Threads take blocks of `grain` consecutive
+ * indices until none are left, so uneven per-index costs still balance. Inputs smaller than two
+ * blocks run on the calling thread. The first exception thrown by fn is rethrown once every thread
+ * has finished]
+ * @param size        [number of indices]
+ * @param fn          [callable taking a std::size_t, called concurrently for different indices]
+ * @param grain       [indices per block]
+ * @param max_threads [upper bound of threads including the caller, 0 for the hardware concurrency]
+ */
+template <typename Fn>
+void parallelFor(
+  const std::size_t size, const Fn & fn, const std::size_t grain = 1024,
+  const std::size_t max_threads = 0)
+{
+  const std::size_t block_size = std::max<std::size_t>(1, grain);
+  const std::size_t block_count = (size + block_size - 1) / block_size;
+  const std::size_t hardware_threads = std::max(1U, std::thread::hardware_concurrency());
+  const std::size_t thread_limit = max_threads == 0 ? hardware_threads : max_threads;
+  const std::size_t thread_count = std::min(thread_limit, block_count);
+
+  if (thread_count <= 1) {
+    for (std::size_t i = 0; i < size; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_block{0};
+  std::vector<std::exception_ptr> errors(thread_count);
+  const auto work = [&](const std::size_t thread_index) {
+    try {
+      for (;;) {
+        const auto block = next_block.fetch_add(1, std::memory_order_relaxed);
+        if (block >= block_count) {
+          return;
+        }
+        const auto end = std::min(size, (block + 1) * block_size);
+        for (std::size_t i = block * block_size; i < end; ++i) {
+          fn(i);
+        }
+      }
+    } catch (...) {
+      errors[thread_index] = std::current_exception();
+      // let the other threads run out of work early
+      next_block.store(block_count, std::memory_order_relaxed);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(thread_count - 1);
+  for (std::size_t t = 1; t < thread_count; ++t) {
+    workers.emplace_back(work, t);
+  }
+  work(0);
+  for (auto & worker : workers) {
+    worker.join();
+  }
+  for (const auto & error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+}  // namespace lanelet::utils::impl
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__LIB__PARALLEL_HPP_
+
+// NOLINTEND(readability-identifier-naming)
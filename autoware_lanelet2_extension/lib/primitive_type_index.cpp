@@ -0,0 +1,174 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/primitive_type_index.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils
+{
+namespace
+{
+/// primitives of one layer grouped by type, and within each type by subtype
+template <typename PrimitiveT>
+struct TypeGroups
+{
+  struct Group
+  {
+    std::vector<PrimitiveT> primitives;
+    std::vector<std::size_t> positions;  // position of each primitive in the layer
+    std::unordered_map<std::string, std::vector<PrimitiveT>> subtypes;
+  };
+  std::unordered_map<std::string, Group> types;
+
+  template <typename LayerT>
+  void build(const LayerT & layer)
+  {
+    std::size_t position = 0;
+    for (const PrimitiveT primitive : layer) {
+      const std::string type = primitive.attributeOr(lanelet::AttributeName::Type, "none");
+      const std::string subtype = primitive.attributeOr(lanelet::AttributeName::Subtype, "none");
+      auto & group = types[type];
+      group.primitives.push_back(primitive);
+      group.positions.push_back(position++);
+      group.subtypes[subtype].push_back(primitive);
+    }
+  }
+
+  /// primitives of any of the types, merged back into the order of the layer
+  std::vector<PrimitiveT> find(const std::vector<std::string> & type_names) const
+  {
+    std::vector<std::pair<std::size_t, PrimitiveT>> found;
+    for (const auto & type : type_names) {
+      const auto it = types.find(type);
+      if (it == types.end()) {
+        continue;
+      }
+      for (std::size_t i = 0; i < it->second.primitives.size(); ++i) {
+        found.emplace_back(it->second.positions[i], it->second.primitives[i]);
+      }
+    }
+    std::sort(found.begin(), found.end(), [](const auto & x, const auto & y) {
+      return x.first < y.first;
+    });
+    std::vector<PrimitiveT> primitives;
+    primitives.reserve(found.size());
+    for (const auto & entry : found) {
+      primitives.push_back(entry.second);
+    }
+    return primitives;
+  }
+
+  const std::vector<PrimitiveT> & find(const std::string & type) const
+  {
+    static const std::vector<PrimitiveT> none;
+    const auto it = types.find(type);
+    return it == types.end() ? none : it->second.primitives;
+  }
+
+  const std::vector<PrimitiveT> & find(const std::string & type, const std::string & subtype) const
+  {
+    static const std::vector<PrimitiveT> none;
+    const auto type_it = types.find(type);
+    if (type_it == types.end()) {
+      return none;
+    }
+    const auto subtype_it = type_it->second.subtypes.find(subtype);
+    return subtype_it == type_it->second.subtypes.end() ? none : subtype_it->second;
+  }
+};
+}  // namespace
+
+struct PrimitiveTypeIndex::Impl
+{
+  TypeGroups<lanelet::ConstLineString3d> line_strings;
+  TypeGroups<lanelet::ConstPolygon3d> polygons;
+  lanelet::ConstLineStrings3d waypoints;
+};
+
+PrimitiveTypeIndex::PrimitiveTypeIndex() : impl_(std::make_shared<const Impl>())
+{
+}
+
+PrimitiveTypeIndex::PrimitiveTypeIndex(const lanelet::LaneletMapConstPtr & lanelet_map_ptr)
+: PrimitiveTypeIndex()
+{
+  if (!lanelet_map_ptr) {
+    std::cerr << __FUNCTION__ << ": lanelet_map_ptr is null pointer!" << std::endl;
+    return;
+  }
+
+  auto impl = std::make_shared<Impl>();
+  impl->line_strings.build(lanelet_map_ptr->lineStringLayer);
+  impl->polygons.build(lanelet_map_ptr->polygonLayer);
+  for (const auto & ll : lanelet_map_ptr->laneletLayer) {
+    if (!ll.hasAttribute("waypoints")) {
+      continue;
+    }
+    const auto waypoints_id = ll.attribute("waypoints").asId();
+    if (!waypoints_id) {
+      continue;
+    }
+    const auto waypoints = lanelet_map_ptr->lineStringLayer.find(*waypoints_id);
+    if (waypoints != lanelet_map_ptr->lineStringLayer.end()) {
+      impl->waypoints.push_back(*waypoints);
+    }
+  }
+  impl_ = std::move(impl);
+}
+
+const lanelet::ConstLineStrings3d & PrimitiveTypeIndex::lineStrings(const std::string & type) const
+{
+  return impl_->line_strings.find(type);
+}
+
+const lanelet::ConstLineStrings3d & PrimitiveTypeIndex::lineStrings(
+  const std::string & type, const std::string & subtype) const
+{
+  return impl_->line_strings.find(type, subtype);
+}
+
+lanelet::ConstLineStrings3d PrimitiveTypeIndex::lineStringsOfTypes(
+  const std::vector<std::string> & types) const
+{
+  return impl_->line_strings.find(types);
+}
+
+const lanelet::ConstPolygons3d & PrimitiveTypeIndex::polygons(const std::string & type) const
+{
+  return impl_->polygons.find(type);
+}
+
+const lanelet::ConstPolygons3d & PrimitiveTypeIndex::polygons(
+  const std::string & type, const std::string & subtype) const
+{
+  return impl_->polygons.find(type, subtype);
+}
+
+const lanelet::ConstLineStrings3d & PrimitiveTypeIndex::waypoints() const
+{
+  return impl_->waypoints;
+}
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
@@ -19,6 +19,7 @@
 #include "autoware_lanelet2_extension/utility/query.hpp"
 
 #include "./deprecated.hpp"
+#include "./parallel.hpp"
 #include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
 #include "autoware_lanelet2_extension/regulatory_elements/bus_stop_area.hpp"
 #include "autoware_lanelet2_extension/regulatory_elements/crosswalk.hpp"
@@ -36,12 +37,17 @@
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_routing/RoutingGraph.h>
 
+#include <algorithm>
+#include <cmath>
 #include <deque>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -76,217 +82,92 @@ lanelet::ConstLanelets bicycleLaneLanelets(const lanelet::ConstLanelets & lls)
 
 std::vector<lanelet::TrafficLightConstPtr> trafficLights(const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::TrafficLightConstPtr> tl_reg_elems;
-
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::TrafficLightConstPtr> ll_tl_re =
-      ll.regulatoryElementsAs<lanelet::TrafficLight>();
-
-    // insert unique tl into array
-    for (const auto & tl_ptr : ll_tl_re) {
-      lanelet::Id id = tl_ptr->id();
-      bool unique_id = true;
-      for (const auto & tl_reg_elem : tl_reg_elems) {
-        if (id == tl_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
-      if (unique_id) {
-        tl_reg_elems.push_back(tl_ptr);
-      }
-    }
-  }
-  return tl_reg_elems;
+  return regulatoryElementsOfType<lanelet::TrafficLight>(lanelets);
 }
 
 std::vector<lanelet::AutowareTrafficLightConstPtr> autowareTrafficLights(
   const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::AutowareTrafficLightConstPtr> tl_reg_elems;
-
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::AutowareTrafficLightConstPtr> ll_tl_re =
-      ll.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>();
-
-    // insert unique tl into array
-    for (const auto & tl_ptr : ll_tl_re) {
-      lanelet::Id id = tl_ptr->id();
-      bool unique_id = true;
-
-      for (const auto & tl_reg_elem : tl_reg_elems) {
-        if (id == tl_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
-
-      if (unique_id) {
-        tl_reg_elems.push_back(tl_ptr);
-      }
-    }
-  }
-  return tl_reg_elems;
+  return regulatoryElementsOfType<lanelet::autoware::AutowareTrafficLight>(lanelets);
 }
 
 std::vector<lanelet::DetectionAreaConstPtr> detectionAreas(const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::DetectionAreaConstPtr> da_reg_elems;
-
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::DetectionAreaConstPtr> ll_da_re =
-      ll.regulatoryElementsAs<lanelet::autoware::DetectionArea>();
-
-    // insert unique tl into array
-    for (const auto & da_ptr : ll_da_re) {
-      lanelet::Id id = da_ptr->id();
-      bool unique_id = true;
-
-      for (const auto & da_reg_elem : da_reg_elems) {
-        if (id == da_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
-
-      if (unique_id) {
-        da_reg_elems.push_back(da_ptr);
-      }
-    }
-  }
-  return da_reg_elems;
+  return regulatoryElementsOfType<lanelet::autoware::DetectionArea>(lanelets);
 }
 
 std::vector<lanelet::NoStoppingAreaConstPtr> noStoppingAreas(
   const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::NoStoppingAreaConstPtr> no_reg_elems;
-
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::NoStoppingAreaConstPtr> ll_no_re =
-      ll.regulatoryElementsAs<lanelet::autoware::NoStoppingArea>();
-
-    // insert unique tl into array
-    for (const auto & no_ptr : ll_no_re) {
-      lanelet::Id id = no_ptr->id();
-      bool unique_id = true;
-
-      for (const auto & no_reg_elem : no_reg_elems) {
-        if (id == no_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
-
-      if (unique_id) {
-        no_reg_elems.push_back(no_ptr);
-      }
-    }
-  }
-  return no_reg_elems;
+  return regulatoryElementsOfType<lanelet::autoware::NoStoppingArea>(lanelets);
 }
 
 std::vector<lanelet::NoParkingAreaConstPtr> noParkingAreas(const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::NoParkingAreaConstPtr> no_pa_reg_elems;
+  return regulatoryElementsOfType<lanelet::autoware::NoParkingArea>(lanelets);
+}
 
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::NoParkingAreaConstPtr> ll_no_pa_re =
-      ll.regulatoryElementsAs<lanelet::autoware::NoParkingArea>();
-
-    // insert unique NoParkingArea into array
-    for (const auto & no_pa_ptr : ll_no_pa_re) {
-      lanelet::Id id = no_pa_ptr->id();
-      bool unique_id = true;
-
-      for (const auto & no_reg_elem : no_pa_reg_elems) {
-        if (id == no_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
+std::vector<lanelet::BusStopAreaConstPtr> busStopAreas(const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::BusStopArea>(lanelets);
+}
 
-      if (unique_id) {
-        no_pa_reg_elems.push_back(no_pa_ptr);
-      }
-    }
-  }
-  return no_pa_reg_elems;
+std::vector<lanelet::SpeedBumpConstPtr> speedBumps(const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::SpeedBump>(lanelets);
 }
 
-std::vector<lanelet::BusStopAreaConstPtr> busStopAreas(const lanelet::ConstLanelets & lanelets)
+std::vector<lanelet::CrosswalkConstPtr> crosswalks(const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::BusStopAreaConstPtr> bus_stop_area_reg_elems;
-  std::set<lanelet::Id> found_ids;
+  return regulatoryElementsOfType<lanelet::autoware::Crosswalk>(lanelets);
+}
 
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::BusStopAreaConstPtr> reg_elems =
-      ll.regulatoryElementsAs<lanelet::autoware::BusStopArea>();
-    for (const auto & reg_elem : reg_elems) {
-      const auto id = reg_elem->id();
-      if (found_ids.find(id) == found_ids.end()) {
-        found_ids.insert(id);
-        bus_stop_area_reg_elems.push_back(reg_elem);
-      }
-    }
-  }
-  return bus_stop_area_reg_elems;
+std::vector<lanelet::TrafficLightConstPtr> trafficLights(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::TrafficLight>(index, lanelets);
 }
 
-std::vector<lanelet::SpeedBumpConstPtr> speedBumps(const lanelet::ConstLanelets & lanelets)
+std::vector<lanelet::AutowareTrafficLightConstPtr> autowareTrafficLights(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::SpeedBumpConstPtr> sb_reg_elems;
+  return regulatoryElementsOfType<lanelet::autoware::AutowareTrafficLight>(index, lanelets);
+}
 
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::SpeedBumpConstPtr> ll_sb_re =
-      ll.regulatoryElementsAs<lanelet::autoware::SpeedBump>();
-
-    // insert unique id into array
-    for (const auto & sb_ptr : ll_sb_re) {
-      lanelet::Id id = sb_ptr->id();
-      bool unique_id = true;
-
-      for (const auto & sb_reg_elem : sb_reg_elems) {
-        if (id == sb_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
+std::vector<lanelet::DetectionAreaConstPtr> detectionAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::DetectionArea>(index, lanelets);
+}
 
-      if (unique_id) {
-        sb_reg_elems.push_back(sb_ptr);
-      }
-    }
-  }
-  return sb_reg_elems;
+std::vector<lanelet::NoStoppingAreaConstPtr> noStoppingAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::NoStoppingArea>(index, lanelets);
 }
 
-std::vector<lanelet::CrosswalkConstPtr> crosswalks(const lanelet::ConstLanelets & lanelets)
+std::vector<lanelet::NoParkingAreaConstPtr> noParkingAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
 {
-  std::vector<lanelet::CrosswalkConstPtr> cw_reg_elems;
+  return regulatoryElementsOfType<lanelet::autoware::NoParkingArea>(index, lanelets);
+}
 
-  for (const auto & ll : lanelets) {
-    std::vector<lanelet::CrosswalkConstPtr> ll_cw_re =
-      ll.regulatoryElementsAs<lanelet::autoware::Crosswalk>();
-
-    // insert unique id into array
-    for (const auto & cw_ptr : ll_cw_re) {
-      lanelet::Id id = cw_ptr->id();
-      bool unique_id = true;
-
-      for (const auto & cw_reg_elem : cw_reg_elems) {
-        if (id == cw_reg_elem->id()) {
-          unique_id = false;
-          break;
-        }
-      }
+std::vector<lanelet::BusStopAreaConstPtr> busStopAreas(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::BusStopArea>(index, lanelets);
+}
 
-      if (unique_id) {
-        cw_reg_elems.push_back(cw_ptr);
-      }
-    }
-  }
-  return cw_reg_elems;
+std::vector<lanelet::SpeedBumpConstPtr> speedBumps(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::SpeedBump>(index, lanelets);
+}
+
+std::vector<lanelet::CrosswalkConstPtr> crosswalks(
+  const RegulatoryElementIndex & index, const lanelet::ConstLanelets & lanelets)
+{
+  return regulatoryElementsOfType<lanelet::autoware::Crosswalk>(index, lanelets);
 }
 
 lanelet::ConstLineStrings3d curbstones(const lanelet::LaneletMapConstPtr & lanelet_map_ptr)
@@ -412,6 +293,75 @@ lanelet::ConstLineStrings3d getAllWaypoints(const lanelet::LaneletMapConstPtr &
   return waypoints;
 }
 
+lanelet::ConstLineStrings3d curbstones(const PrimitiveTypeIndex & index)
+{
+  return index.lineStrings("curbstone");
+}
+
+lanelet::ConstPolygons3d getAllObstaclePolygons(const PrimitiveTypeIndex & index)
+{
+  return index.polygons("obstacle");
+}
+
+lanelet::ConstPolygons3d getAllParkingLots(const PrimitiveTypeIndex & index)
+{
+  return index.polygons("parking_lot");
+}
+
+lanelet::ConstLineStrings3d getAllLinestringsWithType(
+  const PrimitiveTypeIndex & index, const std::string & type)
+{
+  return index.lineStrings(type);
+}
+
+lanelet::ConstLineStrings3d getAllPartitions(const PrimitiveTypeIndex & index)
+{
+  return index.lineStringsOfTypes({"guard_rail", "fence", "wall"});
+}
+
+lanelet::ConstLineStrings3d getAllFences(const PrimitiveTypeIndex & index)
+{
+  return index.lineStrings("fence");
+}
+
+lanelet::ConstLineStrings3d getAllPedestrianPolygonMarkings(const PrimitiveTypeIndex & index)
+{
+  lanelet::ConstLineStrings3d pedestrian_polygon_markings;
+  for (const auto & ls : index.lineStrings("pedestrian_marking")) {
+    if (ls.size() >= 3) {
+      pedestrian_polygon_markings.push_back(ls);
+    }
+  }
+  return pedestrian_polygon_markings;
+}
+
+lanelet::ConstLineStrings3d getAllPedestrianLineMarkings(const PrimitiveTypeIndex & index)
+{
+  lanelet::ConstLineStrings3d pedestrian_line_markings;
+  for (const auto & ls : index.lineStrings("pedestrian_marking")) {
+    if (ls.size() < 3) {
+      pedestrian_line_markings.push_back(ls);
+    }
+  }
+  return pedestrian_line_markings;
+}
+
+lanelet::ConstLineStrings3d getAllParkingSpaces(const PrimitiveTypeIndex & index)
+{
+  return index.lineStrings("parking_space");
+}
+
+lanelet::ConstLineStrings3d getAllWaypoints(const PrimitiveTypeIndex & index)
+{
+  return index.waypoints();
+}
+
+lanelet::ConstPolygons3d getAllPolygonsByType(
+  const PrimitiveTypeIndex & index, const std::string & polygon_type)
+{
+  return index.polygons(polygon_type);
+}
+
 bool getLinkedLanelet(
   const lanelet::ConstLineString3d & parking_space,
   const lanelet::LaneletMapConstPtr & lanelet_map_ptr, lanelet::ConstLanelet * linked_lanelet)
@@ -806,9 +756,7 @@ ConstLanelets query::getLaneletsWithinRange(
 {
   ConstLanelets near_lanelets;
   for (const auto & ll : lanelets) {
-    lanelet::BasicPolygon2d poly = ll.polygon2d().basicPolygon();
-    double distance = lanelet::geometry::distance(poly, search_point);
-    if (distance <= range) {
+    if (deprecated::isLaneletWithinRange(ll, search_point, range)) {
       near_lanelets.push_back(ll);
     }
   }
@@ -823,6 +771,99 @@ ConstLanelets query::getLaneletsWithinRange(
     lanelets, lanelet::BasicPoint2d(search_point.x, search_point.y), range);
 }
 
+ConstLanelets query::getLaneletsWithinRange(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::BasicPoint2d & search_point,
+  const double range)
+{
+  ConstLanelets near_lanelets;
+  if (!lanelet_map_ptr) {
+    return near_lanelets;
+  }
+
+  const lanelet::BasicPoint2d offset(range, range);
+  const lanelet::BasicPoint2d min_corner = search_point - offset;
+  const lanelet::BasicPoint2d max_corner = search_point + offset;
+  const lanelet::BoundingBox2d search_box(min_corner, max_corner);
+  for (const auto & ll : lanelet_map_ptr->laneletLayer.search(search_box)) {
+    if (lanelet::geometry::distance(ll.polygon2d().basicPolygon(), search_point) <= range) {
+      near_lanelets.push_back(ll);
+    }
+  }
+  const auto by_id = [](const auto & lhs, const auto & rhs) { return lhs.id() < rhs.id(); };
+  std::sort(near_lanelets.begin(), near_lanelets.end(), by_id);
+  return near_lanelets;
+}
+
+ConstLanelets query::getLaneletsWithinRange(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const geometry_msgs::msg::Point & search_point, const double range)
+{
+  return getLaneletsWithinRange(
+    lanelet_map_ptr, lanelet::BasicPoint2d(search_point.x, search_point.y), range);
+}
+
+namespace
+{
+double polygonDistance(
+  const lanelet::ConstLanelet & llt, const lanelet::BasicPoint2d & point,
+  const LaneletGeometryCache & geometry_cache)
+{
+  if (const auto * geometry = geometry_cache.find(llt)) {
+    return boost::geometry::distance(geometry->polygon, point);
+  }
+  return boost::geometry::distance(llt.polygon2d().basicPolygon(), point);
+}
+
+bool isWithinPolygonDistance(
+  const lanelet::ConstLanelet & llt, const lanelet::BasicPoint2d & point, const double range,
+  const LaneletGeometryCache & geometry_cache)
+{
+  // the search box of the map is a square, skip lanelets in its corners before measuring the
+  // distance to the polygon
+  const auto * geometry = geometry_cache.find(llt);
+  if (geometry && geometry->bounding_box.exteriorDistance(point) > range) {
+    return false;
+  }
+  return polygonDistance(llt, point, geometry_cache) <= range;
+}
+}  // namespace
+
+ConstLanelets query::getLaneletsWithinRange(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::BasicPoint2d & search_point,
+  const double range, const LaneletGeometryCache & geometry_cache)
+{
+  ConstLanelets near_lanelets;
+  if (!lanelet_map_ptr) {
+    return near_lanelets;
+  }
+
+  const lanelet::BasicPoint2d offset(range, range);
+  const lanelet::BasicPoint2d min_corner = search_point - offset;
+  const lanelet::BasicPoint2d max_corner = search_point + offset;
+  const lanelet::BoundingBox2d search_box(min_corner, max_corner);
+  for (const auto & ll : lanelet_map_ptr->laneletLayer.search(search_box)) {
+    if (isWithinPolygonDistance(ll, search_point, range, geometry_cache)) {
+      near_lanelets.push_back(ll);
+    }
+  }
+  const auto by_id = [](const auto & lhs, const auto & rhs) { return lhs.id() < rhs.id(); };
+  std::sort(near_lanelets.begin(), near_lanelets.end(), by_id);
+  return near_lanelets;
+}
+
+ConstLanelets query::getLaneletsWithinRange(
+  const LaneletSubsetIndex & index, const lanelet::BasicPoint2d & search_point, const double range)
+{
+  return index.withinRange(search_point, range);
+}
+
+ConstLanelets query::getLaneletsWithinRange(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Point & search_point,
+  const double range)
+{
+  return index.withinRange(lanelet::BasicPoint2d(search_point.x, search_point.y), range);
+}
+
 ConstLanelets query::getLaneChangeableNeighbors(
   const routing::RoutingGraphPtr & graph, const ConstLanelet & lanelet)
 {
@@ -900,6 +941,112 @@ ConstLanelets query::getAllNeighbors(
   return road_slices;
 }
 
+namespace
+{
+lanelet::ConstLanelets laneletsContaining(
+  const lanelet::LaneletMap & map, const lanelet::BasicPoint2d & search_point)
+{
+  // the R-tree holds bounding boxes, only their hits need the exact test
+  lanelet::ConstLanelets lanelets;
+  const auto & layer = map.laneletLayer;
+  for (const auto & llt : layer.search(lanelet::BoundingBox2d(search_point, search_point))) {
+    if (lanelet::geometry::inside(llt, search_point)) {
+      lanelets.push_back(llt);
+    }
+  }
+  std::sort(lanelets.begin(), lanelets.end(), [](const auto & lhs, const auto & rhs) {
+    return lhs.id() < rhs.id();
+  });
+  return lanelets;
+}
+
+/// lanelets of the map tied for the smallest distance to the search point, sorted by id
+lanelet::ConstLanelets closestLaneletCandidates(
+  const lanelet::LaneletMap & map, const lanelet::BasicPoint2d & search_point)
+{
+  // lanelets are visited in order of their bounding box distance, which is never larger than the
+  // polygon distance. Comparable (squared) distances are used like in the linear search, so the
+  // same lanelets are regarded as tied
+  lanelet::ConstLanelets candidate_lanelets;
+  double min_distance = std::numeric_limits<double>::max();
+  map.laneletLayer.nearestUntil(
+    search_point, [&](const lanelet::BoundingBox2d & box, const lanelet::ConstLanelet & llt) {
+      const double box_distance = boost::geometry::comparable_distance(box, search_point);
+      if (box_distance > min_distance + std::numeric_limits<double>::epsilon()) {
+        return true;  // no farther lanelet can be closer or tied
+      }
+      const double distance =
+        boost::geometry::comparable_distance(llt.polygon2d().basicPolygon(), search_point);
+      if (std::abs(distance - min_distance) <= std::numeric_limits<double>::epsilon()) {
+        candidate_lanelets.push_back(llt);
+      } else if (distance < min_distance) {
+        candidate_lanelets.clear();
+        candidate_lanelets.push_back(llt);
+        min_distance = distance;
+      }
+      return false;
+    });
+
+  // the R-tree order of tied lanelets is arbitrary
+  const auto by_id = [](const auto & lhs, const auto & rhs) { return lhs.id() < rhs.id(); };
+  std::sort(candidate_lanelets.begin(), candidate_lanelets.end(), by_id);
+  return candidate_lanelets;
+}
+
+/// picks the lanelet whose centerline direction near the pose is closest to its yaw
+void selectClosestLaneletByYaw(
+  const lanelet::ConstLanelets & candidate_lanelets, const geometry_msgs::msg::Pose & search_pose,
+  lanelet::ConstLanelet * closest_lanelet_ptr)
+{
+  const lanelet::BasicPoint2d search_point(search_pose.position.x, search_pose.position.y);
+  double min_angle = std::numeric_limits<double>::max();
+  double pose_yaw = tf2::getYaw(search_pose.orientation);
+  for (const auto & llt : candidate_lanelets) {
+    lanelet::ConstLineString3d segment =
+      deprecated::getClosestSegment(search_point, llt.centerline());
+    double angle_diff = M_PI;
+    if (!segment.empty()) {
+      double segment_angle = std::atan2(
+        segment.back().y() - segment.front().y(), segment.back().x() - segment.front().x());
+      angle_diff = std::abs(deprecated::normalize_radian(segment_angle - pose_yaw));
+    }
+    if (angle_diff < min_angle) {
+      min_angle = angle_diff;
+      *closest_lanelet_ptr = llt;
+    }
+  }
+}
+
+/// picks the nearest of the lanelets sorted by distance whose direction is within yaw_threshold
+bool selectClosestLaneletWithinYaw(
+  const std::vector<std::pair<lanelet::ConstLanelet, double>> & candidate_lanelets,
+  const geometry_msgs::msg::Pose & search_pose, const double yaw_threshold,
+  lanelet::ConstLanelet * closest_lanelet_ptr)
+{
+  bool found = false;
+  double min_angle = std::numeric_limits<double>::max();
+  double min_distance = std::numeric_limits<double>::max();
+  double pose_yaw = tf2::getYaw(search_pose.orientation);
+  for (const auto & llt_pair : candidate_lanelets) {
+    const auto & distance = llt_pair.second;
+
+    double lanelet_angle = deprecated::getLaneletAngle(llt_pair.first, search_pose.position);
+    double angle_diff = std::abs(deprecated::normalize_radian(lanelet_angle - pose_yaw));
+
+    if (angle_diff > std::abs(yaw_threshold)) continue;
+    if (min_distance < distance) break;
+
+    if (angle_diff < min_angle) {
+      min_angle = angle_diff;
+      min_distance = distance;
+      *closest_lanelet_ptr = llt_pair.first;
+      found = true;
+    }
+  }
+  return found;
+}
+}  // namespace
+
 bool query::getClosestLanelet(
   const ConstLanelets & lanelets, const geometry_msgs::msg::Pose & search_pose,
   ConstLanelet * closest_lanelet_ptr)
@@ -943,28 +1090,42 @@ bool query::getClosestLanelet(
   }
 
   // find by angle
-  {
-    double min_angle = std::numeric_limits<double>::max();
-    double pose_yaw = tf2::getYaw(search_pose.orientation);
-    for (const auto & llt : candidate_lanelets) {
-      lanelet::ConstLineString3d segment =
-        deprecated::getClosestSegment(search_point, llt.centerline());
-      double angle_diff = M_PI;
-      if (!segment.empty()) {
-        double segment_angle = std::atan2(
-          segment.back().y() - segment.front().y(), segment.back().x() - segment.front().x());
-        angle_diff = std::abs(deprecated::normalize_radian(segment_angle - pose_yaw));
-      }
-      if (angle_diff < min_angle) {
-        min_angle = angle_diff;
-        *closest_lanelet_ptr = llt;
-      }
-    }
-  }
+  selectClosestLaneletByYaw(candidate_lanelets, search_pose, closest_lanelet_ptr);
 
   return found;
 }
 
+bool query::getClosestLanelet(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelet * closest_lanelet_ptr)
+{
+  if (closest_lanelet_ptr == nullptr) {
+    std::cerr << "argument closest_lanelet_ptr is null! Failed to find closest lanelet"
+              << std::endl;
+    return false;
+  }
+
+  if (!lanelet_map_ptr) {
+    return false;
+  }
+
+  const auto candidate_lanelets = closestLaneletCandidates(
+    *lanelet_map_ptr, lanelet::BasicPoint2d(search_pose.position.x, search_pose.position.y));
+  if (candidate_lanelets.empty()) {
+    return false;
+  }
+
+  if (candidate_lanelets.size() == 1) {
+    *closest_lanelet_ptr = candidate_lanelets.front();
+    return true;
+  }
+
+  // find by angle
+  selectClosestLaneletByYaw(candidate_lanelets, search_pose, closest_lanelet_ptr);
+
+  return true;
+}
+
 bool query::getClosestLaneletWithConstrains(
   const ConstLanelets & lanelets, const geometry_msgs::msg::Pose & search_pose,
   ConstLanelet * closest_lanelet_ptr, const double dist_threshold, const double yaw_threshold)
@@ -995,41 +1156,89 @@ bool query::getClosestLaneletWithConstrains(
     }
 
     if (!candidate_lanelets.empty()) {
-      // sort by distance
-      std::sort(
+      // sort by distance, lanelets at the same distance keep their order as in the overload
+      // taking a LaneletSubsetIndex
+      std::stable_sort(
         candidate_lanelets.begin(), candidate_lanelets.end(),
         [](
           const std::pair<lanelet::ConstLanelet, double> & x,
-          std::pair<lanelet::ConstLanelet, double> & y) { return x.second < y.second; });
+          const std::pair<lanelet::ConstLanelet, double> & y) { return x.second < y.second; });
     } else {
       return found;
     }
   }
 
   // find closest lanelet within yaw_threshold
-  {
-    double min_angle = std::numeric_limits<double>::max();
-    double min_distance = std::numeric_limits<double>::max();
-    double pose_yaw = tf2::getYaw(search_pose.orientation);
-    for (const auto & llt_pair : candidate_lanelets) {
-      const auto & distance = llt_pair.second;
+  found = selectClosestLaneletWithinYaw(
+    candidate_lanelets, search_pose, yaw_threshold, closest_lanelet_ptr);
 
-      double lanelet_angle = deprecated::getLaneletAngle(llt_pair.first, search_pose.position);
-      double angle_diff = std::abs(deprecated::normalize_radian(lanelet_angle - pose_yaw));
+  return found;
+}
+
+bool query::getClosestLanelet(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelet * closest_lanelet_ptr)
+{
+  if (closest_lanelet_ptr == nullptr) {
+    std::cerr << "argument closest_lanelet_ptr is null! Failed to find closest lanelet"
+              << std::endl;
+    return false;
+  }
 
-      if (angle_diff > std::abs(yaw_threshold)) continue;
-      if (min_distance < distance) break;
+  const lanelet::BasicPoint2d search_point(search_pose.position.x, search_pose.position.y);
+  const auto nearest_lanelets = index.nearest(search_point, 1);
+  if (nearest_lanelets.empty()) {
+    return false;
+  }
 
-      if (angle_diff < min_angle) {
-        min_angle = angle_diff;
-        min_distance = distance;
-        *closest_lanelet_ptr = llt_pair.first;
-        found = true;
-      }
+  // find by distance, collecting the lanelets tied with the nearest one like the linear search
+  const double min_distance = boost::geometry::comparable_distance(
+    nearest_lanelets.front().polygon2d().basicPolygon(), search_point);
+  const double tie_range = std::sqrt(min_distance + std::numeric_limits<double>::epsilon());
+  lanelet::ConstLanelets candidate_lanelets;
+  for (const auto & llt : index.withinRange(search_point, tie_range)) {
+    const double distance =
+      boost::geometry::comparable_distance(llt.polygon2d().basicPolygon(), search_point);
+    if (std::abs(distance - min_distance) <= std::numeric_limits<double>::epsilon()) {
+      candidate_lanelets.push_back(llt);
     }
   }
 
-  return found;
+  if (candidate_lanelets.size() <= 1) {
+    *closest_lanelet_ptr = nearest_lanelets.front();
+    return true;
+  }
+
+  // find by angle
+  selectClosestLaneletByYaw(candidate_lanelets, search_pose, closest_lanelet_ptr);
+
+  return true;
+}
+
+bool query::getClosestLaneletWithConstrains(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelet * closest_lanelet_ptr, const double dist_threshold, const double yaw_threshold)
+{
+  if (closest_lanelet_ptr == nullptr) {
+    std::cerr << "argument closest_lanelet_ptr is null! Failed to find closest lanelet"
+              << std::endl;
+    return false;
+  }
+
+  const lanelet::BasicPoint2d search_point(search_pose.position.x, search_pose.position.y);
+
+  // find by distance
+  auto candidate_lanelets = index.distancesWithinRange(search_point, dist_threshold);
+  if (candidate_lanelets.empty()) {
+    return false;
+  }
+  std::stable_sort(
+    candidate_lanelets.begin(), candidate_lanelets.end(),
+    [](const auto & x, const auto & y) { return x.second < y.second; });
+
+  // find closest lanelet within yaw_threshold
+  return selectClosestLaneletWithinYaw(
+    candidate_lanelets, search_pose, yaw_threshold, closest_lanelet_ptr);
 }
 
 bool query::getCurrentLanelets(
@@ -1080,6 +1289,166 @@ bool query::getCurrentLanelets(
   return !current_lanelets_ptr->empty();  // return found
 }
 
+bool query::getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const geometry_msgs::msg::Point & search_point, ConstLanelets * current_lanelets_ptr)
+{
+  if (current_lanelets_ptr == nullptr) {
+    std::cerr << "argument current_lanelets_ptr is null! Failed to find current lanelets"
+              << std::endl;
+    return false;
+  }
+
+  if (!lanelet_map_ptr) {
+    return false;
+  }
+
+  const auto lanelets =
+    laneletsContaining(*lanelet_map_ptr, lanelet::BasicPoint2d(search_point.x, search_point.y));
+  current_lanelets_ptr->insert(current_lanelets_ptr->end(), lanelets.begin(), lanelets.end());
+  return !lanelets.empty();  // return found
+}
+
+bool query::getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelets * current_lanelets_ptr)
+{
+  return getCurrentLanelets(lanelet_map_ptr, search_pose.position, current_lanelets_ptr);
+}
+
+bool query::getCurrentLanelets(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Point & search_point,
+  ConstLanelets * current_lanelets_ptr)
+{
+  if (current_lanelets_ptr == nullptr) {
+    std::cerr << "argument current_lanelets_ptr is null! Failed to find current lanelets"
+              << std::endl;
+    return false;
+  }
+
+  const auto lanelets = index.contains(lanelet::BasicPoint2d(search_point.x, search_point.y));
+  current_lanelets_ptr->insert(current_lanelets_ptr->end(), lanelets.begin(), lanelets.end());
+  return !lanelets.empty();  // return found
+}
+
+bool query::getCurrentLanelets(
+  const LaneletSubsetIndex & index, const geometry_msgs::msg::Pose & search_pose,
+  ConstLanelets * current_lanelets_ptr)
+{
+  return getCurrentLanelets(index, search_pose.position, current_lanelets_ptr);
+}
+
+namespace
+{
+/// consecutive trajectory points searched with one R-tree query
+constexpr std::size_t batch_chunk_size = 16;
+
+std::vector<ConstLanelets> laneletsContaining(
+  const lanelet::LaneletMap & map, const std::vector<lanelet::BasicPoint2d> & search_points,
+  const std::size_t max_threads)
+{
+  std::vector<ConstLanelets> results(search_points.size());
+  const std::size_t chunk_count = (search_points.size() + batch_chunk_size - 1) / batch_chunk_size;
+  impl::parallelFor(
+    chunk_count,
+    [&](const std::size_t chunk) {
+      // neighboring points share most candidates, so the R-tree is searched once with the box
+      // around all of them, and each point only checks the boxes of the hits
+      const std::size_t begin = chunk * batch_chunk_size;
+      const std::size_t end = std::min(search_points.size(), begin + batch_chunk_size);
+      lanelet::BoundingBox2d chunk_box(search_points[begin], search_points[begin]);
+      for (std::size_t i = begin + 1; i < end; ++i) {
+        chunk_box.extend(search_points[i]);
+      }
+      const auto hits = map.laneletLayer.search(chunk_box);
+      std::vector<lanelet::BoundingBox2d> hit_boxes;
+      hit_boxes.reserve(hits.size());
+      for (const auto & llt : hits) {
+        hit_boxes.push_back(lanelet::geometry::boundingBox2d(llt));
+      }
+
+      const auto by_id = [](const auto & lhs, const auto & rhs) { return lhs.id() < rhs.id(); };
+      for (std::size_t i = begin; i < end; ++i) {
+        auto & lanelets = results[i];
+        for (std::size_t h = 0; h < hits.size(); ++h) {
+          if (
+            hit_boxes[h].contains(search_points[i]) &&
+            lanelet::geometry::inside(hits[h], search_points[i])) {
+            lanelets.push_back(hits[h]);
+          }
+        }
+        std::sort(lanelets.begin(), lanelets.end(), by_id);
+      }
+    },
+    1, max_threads);
+  return results;
+}
+}  // namespace
+
+std::vector<ConstLanelets> query::getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const std::vector<geometry_msgs::msg::Point> & search_points, const std::size_t max_threads)
+{
+  if (!lanelet_map_ptr) {
+    return std::vector<ConstLanelets>(search_points.size());
+  }
+  std::vector<lanelet::BasicPoint2d> points;
+  points.reserve(search_points.size());
+  for (const auto & search_point : search_points) {
+    points.emplace_back(search_point.x, search_point.y);
+  }
+  return laneletsContaining(*lanelet_map_ptr, points, max_threads);
+}
+
+std::vector<ConstLanelets> query::getCurrentLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const std::vector<geometry_msgs::msg::Pose> & search_poses, const std::size_t max_threads)
+{
+  if (!lanelet_map_ptr) {
+    return std::vector<ConstLanelets>(search_poses.size());
+  }
+  std::vector<lanelet::BasicPoint2d> points;
+  points.reserve(search_poses.size());
+  for (const auto & search_pose : search_poses) {
+    points.emplace_back(search_pose.position.x, search_pose.position.y);
+  }
+  return laneletsContaining(*lanelet_map_ptr, points, max_threads);
+}
+
+std::vector<std::optional<ConstLanelet>> query::getClosestLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const std::vector<geometry_msgs::msg::Pose> & search_poses, const std::size_t max_threads)
+{
+  std::vector<std::optional<ConstLanelet>> results(search_poses.size());
+  if (!lanelet_map_ptr) {
+    return results;
+  }
+
+  // the distance search only reads the map and runs in parallel. The yaw comparison computes
+  // centerlines, which lanelet2 caches in the lanelet without synchronization, so it stays on this
+  // thread
+  std::vector<ConstLanelets> candidates(search_poses.size());
+  impl::parallelFor(
+    search_poses.size(),
+    [&](const std::size_t i) {
+      const auto & position = search_poses[i].position;
+      candidates[i] =
+        closestLaneletCandidates(*lanelet_map_ptr, lanelet::BasicPoint2d(position.x, position.y));
+    },
+    batch_chunk_size, max_threads);
+
+  for (std::size_t i = 0; i < search_poses.size(); ++i) {
+    if (candidates[i].size() == 1) {
+      results[i] = candidates[i].front();
+    } else if (candidates[i].size() > 1) {
+      ConstLanelet closest_lanelet;
+      selectClosestLaneletByYaw(candidates[i], search_poses[i], &closest_lanelet);
+      results[i] = closest_lanelet;
+    }
+  }
+  return results;
+}
+
 std::vector<std::deque<lanelet::ConstLanelet>> getSucceedingLaneletSequencesRecursive(
   const routing::RoutingGraphPtr & graph, const lanelet::ConstLanelet & lanelet,
   const double length)
@@ -1107,9 +1476,22 @@ std::vector<std::deque<lanelet::ConstLanelet>> getSucceedingLaneletSequencesRecu
   return succeeding_lanelet_sequences;
 }
 
+namespace
+{
+std::unordered_set<lanelet::Id> toIdSet(const lanelet::ConstLanelets & lanelets)
+{
+  std::unordered_set<lanelet::Id> ids;
+  ids.reserve(lanelets.size());
+  for (const auto & llt : lanelets) {
+    ids.insert(llt.id());
+  }
+  return ids;
+}
+}  // namespace
+
 std::vector<std::deque<lanelet::ConstLanelet>> getPrecedingLaneletSequencesRecursive(
   const routing::RoutingGraphPtr & graph, const lanelet::ConstLanelet & lanelet,
-  const double length, const lanelet::ConstLanelets & exclude_lanelets)
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids)
 {
   std::vector<std::deque<lanelet::ConstLanelet>> preceding_lanelet_sequences;
 
@@ -1123,7 +1505,7 @@ std::vector<std::deque<lanelet::ConstLanelet>> getPrecedingLaneletSequencesRecur
   }
 
   for (const auto & prev_lanelet : prev_lanelets) {
-    if (lanelet::utils::contains(exclude_lanelets, prev_lanelet)) {
+    if (exclude_ids.count(prev_lanelet.id()) != 0) {
       // if prev_lanelet is included in exclude_lanelets,
       // remove prev_lanelet from preceding_lanelet_sequences
       continue;
@@ -1131,7 +1513,7 @@ std::vector<std::deque<lanelet::ConstLanelet>> getPrecedingLaneletSequencesRecur
 
     // get lanelet sequence after prev_lanelet
     auto tmp_lanelet_sequences = getPrecedingLaneletSequencesRecursive(
-      graph, prev_lanelet, length - lanelet_length, exclude_lanelets);
+      graph, prev_lanelet, length - lanelet_length, exclude_ids);
     for (auto & tmp_lanelet_sequence : tmp_lanelet_sequences) {
       tmp_lanelet_sequence.push_back(lanelet);
       preceding_lanelet_sequences.push_back(tmp_lanelet_sequence);
@@ -1144,6 +1526,162 @@ std::vector<std::deque<lanelet::ConstLanelet>> getPrecedingLaneletSequencesRecur
   return preceding_lanelet_sequences;
 }
 
+namespace
+{
+/// iterative depth-first search over the lanelets following or preceding a lanelet, which visits
+/// the lanelets in the same order as getSucceedingLaneletSequencesRecursive and
+/// getPrecedingLaneletSequencesRecursive
+class LaneletSequenceSearch
+{
+public:
+  LaneletSequenceSearch(
+    const routing::RoutingGraphConstPtr & graph, const bool forward,
+    const std::unordered_set<lanelet::Id> & exclude_ids, const std::size_t max_sequences,
+    const LaneletGeometryCache * geometry_cache, query::LaneletSequences * sequences)
+  : graph_(graph),
+    forward_(forward),
+    exclude_ids_(exclude_ids),
+    max_sequences_(max_sequences),
+    geometry_cache_(geometry_cache),
+    sequences_(sequences)
+  {
+  }
+
+  /// appends the sequences starting at root, returns false once max_sequences is exceeded
+  bool search(const lanelet::ConstLanelet & root, const double length)
+  {
+    if (!visit(root, length)) {
+      return false;
+    }
+    while (!stack_.empty()) {
+      auto & top = stack_.back();
+      if (top.next_child == top.children.size()) {
+        stack_.pop_back();
+        continue;
+      }
+      const auto child = top.children[top.next_child++];
+      if (!visit(child, top.remaining)) {
+        stack_.clear();
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  struct Frame
+  {
+    lanelet::ConstLanelet lanelet;
+    double remaining;  // length left for the lanelets after this one
+    lanelet::ConstLanelets children;
+    std::size_t next_child;
+  };
+
+  bool visit(const lanelet::ConstLanelet & llt, const double remaining)
+  {
+    const double lanelet_length = length(llt);
+    stack_.push_back(Frame{llt, remaining - lanelet_length, {}, 0});
+    if (lanelet_length < remaining) {
+      stack_.back().children = children(llt);
+    }
+    if (!stack_.back().children.empty()) {
+      return true;
+    }
+    const bool emitted = emit();
+    stack_.pop_back();
+    return emitted;
+  }
+
+  lanelet::ConstLanelets children(const lanelet::ConstLanelet & llt) const
+  {
+    auto children = forward_ ? graph_->following(llt) : graph_->previous(llt);
+    const auto excluded = [this](const lanelet::ConstLanelet & child) {
+      return exclude_ids_.count(child.id()) != 0;
+    };
+    children.erase(std::remove_if(children.begin(), children.end(), excluded), children.end());
+    return children;
+  }
+
+  double length(const lanelet::ConstLanelet & llt)
+  {
+    const auto it = lengths_.find(llt.id());
+    if (it != lengths_.end()) {
+      return it->second;
+    }
+    const double lanelet_length = geometry_cache_ != nullptr ? geometry_cache_->length3d(llt)
+                                                             : lanelet::geometry::length3d(llt);
+    lengths_.emplace(llt.id(), lanelet_length);
+    return lanelet_length;
+  }
+
+  /// writes the lanelets on the stack as a sequence
+  bool emit()
+  {
+    if (sequences_->size() >= max_sequences_) {
+      sequences_->truncated = true;
+      return false;
+    }
+    if (forward_) {
+      for (const auto & frame : stack_) {
+        sequences_->lanelets.push_back(frame.lanelet);
+      }
+    } else {
+      for (auto it = stack_.rbegin(); it != stack_.rend(); ++it) {
+        sequences_->lanelets.push_back(it->lanelet);
+      }
+    }
+    sequences_->offsets.push_back(sequences_->lanelets.size());
+    return true;
+  }
+
+  routing::RoutingGraphConstPtr graph_;
+  bool forward_;
+  const std::unordered_set<lanelet::Id> & exclude_ids_;  // outlives the search
+  std::size_t max_sequences_;
+  const LaneletGeometryCache * geometry_cache_;  // optional, outlives the search
+  query::LaneletSequences * sequences_;
+  std::vector<Frame> stack_;
+  std::unordered_map<lanelet::Id, double> lengths_;
+};
+
+query::LaneletSequences enumerateSucceedingSequences(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const std::size_t max_sequences, const LaneletGeometryCache * geometry_cache)
+{
+  query::LaneletSequences sequences;
+  LaneletSequenceSearch search(graph, true, exclude_ids, max_sequences, geometry_cache, &sequences);
+  for (const auto & next_lanelet : graph->following(lanelet)) {
+    if (exclude_ids.count(next_lanelet.id()) != 0) {
+      continue;
+    }
+    if (!search.search(next_lanelet, length)) {
+      break;
+    }
+  }
+  return sequences;
+}
+
+query::LaneletSequences enumeratePrecedingSequences(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const std::size_t max_sequences, const LaneletGeometryCache * geometry_cache)
+{
+  query::LaneletSequences sequences;
+  LaneletSequenceSearch search(
+    graph, false, exclude_ids, max_sequences, geometry_cache, &sequences);
+  for (const auto & prev_lanelet : graph->previous(lanelet)) {
+    if (exclude_ids.count(prev_lanelet.id()) != 0) {
+      continue;
+    }
+    if (!search.search(prev_lanelet, length)) {
+      break;
+    }
+  }
+  return sequences;
+}
+}  // namespace
+
 std::vector<lanelet::ConstLanelets> query::getSucceedingLaneletSequences(
   const routing::RoutingGraphPtr & graph, const lanelet::ConstLanelet & lanelet,
   const double length)
@@ -1165,22 +1703,83 @@ std::vector<lanelet::ConstLanelets> query::getPrecedingLaneletSequences(
   const double length, const lanelet::ConstLanelets & exclude_lanelets)
 {
   std::vector<ConstLanelets> lanelet_sequences_vec;
+  const auto exclude_ids = toIdSet(exclude_lanelets);
   const auto prev_lanelets = graph->previous(lanelet);
   for (const auto & prev_lanelet : prev_lanelets) {
-    if (lanelet::utils::contains(exclude_lanelets, prev_lanelet)) {
+    if (exclude_ids.count(prev_lanelet.id()) != 0) {
       // if prev_lanelet is included in exclude_lanelets,
       // remove prev_lanelet from preceding_lanelet_sequences
       continue;
     }
     // convert deque into vector
     const auto lanelet_sequences_deq =
-      getPrecedingLaneletSequencesRecursive(graph, prev_lanelet, length, exclude_lanelets);
+      getPrecedingLaneletSequencesRecursive(graph, prev_lanelet, length, exclude_ids);
     for (const auto & lanelet_sequence : lanelet_sequences_deq) {
       lanelet_sequences_vec.emplace_back(lanelet_sequence.begin(), lanelet_sequence.end());
     }
   }
   return lanelet_sequences_vec;
 }
+
+std::vector<lanelet::ConstLanelets> query::LaneletSequences::toVectors() const
+{
+  std::vector<lanelet::ConstLanelets> sequences;
+  sequences.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i) {
+    sequences.emplace_back(begin(i), end(i));
+  }
+  return sequences;
+}
+
+query::LaneletSequences query::enumerateSucceedingLaneletSequences(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::size_t max_sequences)
+{
+  return enumerateSucceedingLaneletSequencesExcludingIds(graph, lanelet, length, {}, max_sequences);
+}
+
+query::LaneletSequences query::enumerateSucceedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const std::size_t max_sequences)
+{
+  return enumerateSucceedingSequences(graph, lanelet, length, exclude_ids, max_sequences, nullptr);
+}
+
+query::LaneletSequences query::enumerateSucceedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const LaneletGeometryCache & geometry_cache, const std::size_t max_sequences)
+{
+  return enumerateSucceedingSequences(
+    graph, lanelet, length, exclude_ids, max_sequences, &geometry_cache);
+}
+
+query::LaneletSequences query::enumeratePrecedingLaneletSequences(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const lanelet::ConstLanelets & exclude_lanelets,
+  const std::size_t max_sequences)
+{
+  return enumeratePrecedingLaneletSequencesExcludingIds(
+    graph, lanelet, length, toIdSet(exclude_lanelets), max_sequences);
+}
+
+query::LaneletSequences query::enumeratePrecedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const std::size_t max_sequences)
+{
+  return enumeratePrecedingSequences(graph, lanelet, length, exclude_ids, max_sequences, nullptr);
+}
+
+query::LaneletSequences query::enumeratePrecedingLaneletSequencesExcludingIds(
+  const routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet,
+  const double length, const std::unordered_set<lanelet::Id> & exclude_ids,
+  const LaneletGeometryCache & geometry_cache, const std::size_t max_sequences)
+{
+  return enumeratePrecedingSequences(
+    graph, lanelet, length, exclude_ids, max_sequences, &geometry_cache);
+}
 }  // namespace lanelet::utils
 
 // NOLINTEND(readability-identifier-naming)
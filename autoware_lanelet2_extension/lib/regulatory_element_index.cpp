@@ -0,0 +1,77 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/regulatory_element_index.hpp"
+
+#include <iostream>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils
+{
+namespace
+{
+template <typename RegulatoryElementT>
+void castRegulatoryElements(
+  const lanelet::ConstLanelet & lanelet,
+  std::vector<std::shared_ptr<const RegulatoryElementT>> * regulatory_elements)
+{
+  *regulatory_elements = lanelet.regulatoryElementsAs<RegulatoryElementT>();
+}
+}  // namespace
+
+RegulatoryElementIndex::RegulatoryElementIndex()
+: lanelet_regulatory_elements_(
+    std::make_shared<const std::unordered_map<lanelet::Id, RegulatoryElementsOfLanelet>>())
+{
+}
+
+RegulatoryElementIndex::RegulatoryElementIndex(const lanelet::LaneletMapConstPtr & lanelet_map_ptr)
+: RegulatoryElementIndex()
+{
+  if (!lanelet_map_ptr) {
+    std::cerr << __FUNCTION__ << ": lanelet_map_ptr is null pointer!" << std::endl;
+    return;
+  }
+
+  auto lanelet_regulatory_elements =
+    std::make_shared<std::unordered_map<lanelet::Id, RegulatoryElementsOfLanelet>>();
+  lanelet_regulatory_elements->reserve(lanelet_map_ptr->laneletLayer.size());
+  for (const auto & llt : lanelet_map_ptr->laneletLayer) {
+    if (llt.regulatoryElements().empty()) {
+      continue;
+    }
+    RegulatoryElementsOfLanelet regulatory_elements;
+    std::apply(
+      [&llt](auto &... typed_regulatory_elements) {
+        (castRegulatoryElements(llt, &typed_regulatory_elements), ...);
+      },
+      regulatory_elements);
+    lanelet_regulatory_elements->emplace(llt.id(), std::move(regulatory_elements));
+  }
+  lanelet_regulatory_elements_ = std::move(lanelet_regulatory_elements);
+}
+
+std::size_t RegulatoryElementIndex::size() const
+{
+  return lanelet_regulatory_elements_->size();
+}
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,177 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/traffic_light_index.hpp"
+
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lanelet::utils
+{
+namespace
+{
+template <typename ValueT>
+const ValueT & findOr(
+  const std::unordered_map<lanelet::Id, ValueT> & map, const lanelet::Id id, const ValueT & none)
+{
+  const auto it = map.find(id);
+  return it == map.end() ? none : it->second;
+}
+}  // namespace
+
+struct TrafficLightIndex::Impl
+{
+  std::unordered_map<lanelet::Id, lanelet::AutowareTrafficLightConstPtr> regulatory_elements;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelets> controlled_lanelets;
+  // keyed by traffic light linestring or polygon id
+  std::unordered_map<lanelet::Id, std::vector<lanelet::AutowareTrafficLightConstPtr>>
+    traffic_light_regulatory_elements;
+  // keyed by light bulbs linestring id
+  std::unordered_map<lanelet::Id, std::vector<lanelet::AutowareTrafficLightConstPtr>>
+    light_bulbs_regulatory_elements;
+  // keyed by traffic_light_id
+  std::unordered_map<lanelet::Id, lanelet::ConstLineStrings3d> light_bulbs;
+  // keyed by light bulbs linestring id
+  std::unordered_map<lanelet::Id, lanelet::Id> light_bulbs_traffic_light_id;
+
+  void add(const lanelet::AutowareTrafficLightConstPtr & traffic_light)
+  {
+    regulatory_elements.emplace(traffic_light->id(), traffic_light);
+    for (const auto & base : traffic_light->trafficLights()) {
+      traffic_light_regulatory_elements[base.id()].push_back(traffic_light);
+    }
+    for (const auto & bulbs : traffic_light->lightBulbs()) {
+      light_bulbs_regulatory_elements[bulbs.id()].push_back(traffic_light);
+      if (!bulbs.hasAttribute("traffic_light_id")) {
+        continue;
+      }
+      const auto traffic_light_id = bulbs.attribute("traffic_light_id").asId();
+      if (!traffic_light_id) {
+        continue;
+      }
+      // light bulbs shared by several regulatory elements are listed once
+      if (light_bulbs_traffic_light_id.emplace(bulbs.id(), *traffic_light_id).second) {
+        light_bulbs[*traffic_light_id].push_back(bulbs);
+      }
+    }
+  }
+};
+
+TrafficLightIndex::TrafficLightIndex() : impl_(std::make_shared<const Impl>())
+{
+}
+
+TrafficLightIndex::TrafficLightIndex(const lanelet::LaneletMapConstPtr & lanelet_map_ptr)
+: TrafficLightIndex()
+{
+  if (!lanelet_map_ptr) {
+    std::cerr << __FUNCTION__ << ": lanelet_map_ptr is null pointer!" << std::endl;
+    return;
+  }
+
+  auto impl = std::make_shared<Impl>();
+  for (const auto & regulatory_element : lanelet_map_ptr->regulatoryElementLayer) {
+    const auto traffic_light =
+      std::dynamic_pointer_cast<const lanelet::autoware::AutowareTrafficLight>(regulatory_element);
+    if (traffic_light) {
+      impl->add(traffic_light);
+    }
+  }
+  for (const auto & llt : lanelet_map_ptr->laneletLayer) {
+    for (const auto & traffic_light :
+         llt.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>()) {
+      // traffic lights that are only referenced by lanelets are indexed as well
+      if (impl->regulatory_elements.count(traffic_light->id()) == 0) {
+        impl->add(traffic_light);
+      }
+      impl->controlled_lanelets[traffic_light->id()].push_back(llt);
+    }
+  }
+  impl_ = std::move(impl);
+}
+
+lanelet::AutowareTrafficLightConstPtr TrafficLightIndex::regulatoryElement(
+  const lanelet::Id regulatory_element_id) const
+{
+  const auto it = impl_->regulatory_elements.find(regulatory_element_id);
+  return it == impl_->regulatory_elements.end() ? nullptr : it->second;
+}
+
+const std::vector<lanelet::AutowareTrafficLightConstPtr> &
+TrafficLightIndex::regulatoryElementsOfTrafficLight(const lanelet::Id traffic_light_id) const
+{
+  static const std::vector<lanelet::AutowareTrafficLightConstPtr> none;
+  return findOr(impl_->traffic_light_regulatory_elements, traffic_light_id, none);
+}
+
+const std::vector<lanelet::AutowareTrafficLightConstPtr> &
+TrafficLightIndex::regulatoryElementsOfLightBulbs(const lanelet::Id light_bulbs_id) const
+{
+  static const std::vector<lanelet::AutowareTrafficLightConstPtr> none;
+  return findOr(impl_->light_bulbs_regulatory_elements, light_bulbs_id, none);
+}
+
+const lanelet::ConstLineStrings3d & TrafficLightIndex::lightBulbs(
+  const lanelet::Id traffic_light_id) const
+{
+  static const lanelet::ConstLineStrings3d none;
+  return findOr(impl_->light_bulbs, traffic_light_id, none);
+}
+
+std::optional<lanelet::Id> TrafficLightIndex::trafficLightIdOfLightBulbs(
+  const lanelet::Id light_bulbs_id) const
+{
+  const auto it = impl_->light_bulbs_traffic_light_id.find(light_bulbs_id);
+  if (it == impl_->light_bulbs_traffic_light_id.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+std::optional<lanelet::ConstLineString3d> TrafficLightIndex::stopLine(
+  const lanelet::Id regulatory_element_id) const
+{
+  const auto traffic_light = regulatoryElement(regulatory_element_id);
+  if (!traffic_light) {
+    return std::nullopt;
+  }
+  const auto stop_line = traffic_light->stopLine();
+  if (!stop_line) {
+    return std::nullopt;
+  }
+  return *stop_line;
+}
+
+const lanelet::ConstLanelets & TrafficLightIndex::controlledLanelets(
+  const lanelet::Id regulatory_element_id) const
+{
+  static const lanelet::ConstLanelets none;
+  return findOr(impl_->controlled_lanelets, regulatory_element_id, none);
+}
+
+std::size_t TrafficLightIndex::size() const
+{
+  return impl_->regulatory_elements.size();
+}
+}  // namespace lanelet::utils
+
+// NOLINTEND(readability-identifier-naming)
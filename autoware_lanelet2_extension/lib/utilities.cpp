@@ -19,6 +19,7 @@
 #include "autoware_lanelet2_extension/utility/utilities.hpp"
 
 #include "./deprecated.hpp"
+#include "./parallel.hpp"
 #include "autoware_lanelet2_extension/utility/message_conversion.hpp"
 #include "autoware_lanelet2_extension/utility/query.hpp"
 
@@ -31,12 +32,15 @@
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_core/geometry/Point.h>
 #include <lanelet2_core/primitives/BasicRegulatoryElements.h>
+#include <lanelet2_core/utility/Utilities.h>
 #include <lanelet2_routing/Route.h>
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRules.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <limits>
 #include <map>
@@ -264,6 +268,82 @@ lanelet::LineString3d getLineStringFromArcLength(
   }
   return lanelet::LineString3d{lanelet::InvalId, points};
 }
+
+/// the points of the fine centerline, see generateFineCenterline
+std::vector<lanelet::BasicPoint3d> fineCenterlinePoints(
+  const lanelet::ConstLanelet & lanelet_obj, const double resolution)
+{
+  // Get length of longer border
+  const double left_length =
+    static_cast<double>(lanelet::geometry::length(lanelet_obj.leftBound()));
+  const double right_length =
+    static_cast<double>(lanelet::geometry::length(lanelet_obj.rightBound()));
+  const double longer_distance = (left_length > right_length) ? left_length : right_length;
+  const int num_segments = std::max(static_cast<int>(ceil(longer_distance / resolution)), 1);
+
+  // Resample points
+  const auto left_points = resamplePoints(lanelet_obj.leftBound(), num_segments);
+  const auto right_points = resamplePoints(lanelet_obj.rightBound(), num_segments);
+
+  std::vector<lanelet::BasicPoint3d> center_points;
+  center_points.reserve(static_cast<std::size_t>(num_segments) + 1);
+  for (int i = 0; i < num_segments + 1; i++) {
+    center_points.emplace_back((right_points.at(i) + left_points.at(i)) / 2);
+  }
+  return center_points;
+}
+
+/// sets fine centerlines to the lanelets. The geometry is computed in parallel, the ids of the
+/// centerlines and their points are drawn in advance, in the order of `lanelets`, so they are the
+/// same as if every lanelet called generateFineCenterline in turn
+CenterlineOverwriteStats overwriteCenterlines(
+  const std::vector<lanelet::Lanelet> & lanelets, const double resolution,
+  const std::size_t thread_count)
+{
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  // a centerline takes a few microseconds, so hand out blocks of lanelets
+  constexpr std::size_t centerline_chunk_size = 64;
+
+  std::vector<std::vector<lanelet::BasicPoint3d>> center_points(lanelets.size());
+  impl::parallelFor(
+    lanelets.size(),
+    [&](const std::size_t i) { center_points[i] = fineCenterlinePoints(lanelets[i], resolution); },
+    centerline_chunk_size, thread_count);
+
+  // one id for each centerline and each of its points. getId() is the only atomic way to take ids
+  // from the global counter, so they are drawn one by one before the parallel part
+  std::vector<std::size_t> first_ids(lanelets.size());
+  std::size_t id_count = 0;
+  for (std::size_t i = 0; i < lanelets.size(); ++i) {
+    first_ids[i] = id_count;
+    id_count += center_points[i].size() + 1;
+  }
+  std::vector<lanelet::Id> ids(id_count);
+  for (auto & id : ids) {
+    id = lanelet::utils::getId();
+  }
+
+  impl::parallelFor(
+    lanelets.size(),
+    [&](const std::size_t i) {
+      auto id = ids.begin() + static_cast<std::ptrdiff_t>(first_ids[i]);
+      lanelet::LineString3d centerline(*id++);
+      for (const auto & point : center_points[i]) {
+        centerline.push_back(lanelet::Point3d(*id++, point.x(), point.y(), point.z()));
+      }
+      // every lanelet of a layer owns its data, so they can be changed concurrently
+      lanelet::Lanelet lanelet_obj = lanelets[i];
+      lanelet_obj.setCenterline(centerline);
+    },
+    centerline_chunk_size, thread_count);
+
+  CenterlineOverwriteStats stats;
+  stats.lanelets = lanelets.size();
+  stats.points = id_count - lanelets.size();
+  stats.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  return stats;
+}
 }  // namespace
 
 lanelet::ConstLanelet combineLaneletsShape(const lanelet::ConstLanelets & lanelets)
@@ -304,23 +384,12 @@ lanelet::ConstLanelet combineLaneletsShape(const lanelet::ConstLanelets & lanele
 lanelet::LineString3d generateFineCenterline(
   const lanelet::ConstLanelet & lanelet_obj, const double resolution)
 {
-  // Get length of longer border
-  const double left_length =
-    static_cast<double>(lanelet::geometry::length(lanelet_obj.leftBound()));
-  const double right_length =
-    static_cast<double>(lanelet::geometry::length(lanelet_obj.rightBound()));
-  const double longer_distance = (left_length > right_length) ? left_length : right_length;
-  const int num_segments = std::max(static_cast<int>(ceil(longer_distance / resolution)), 1);
-
-  // Resample points
-  const auto left_points = resamplePoints(lanelet_obj.leftBound(), num_segments);
-  const auto right_points = resamplePoints(lanelet_obj.rightBound(), num_segments);
+  const auto center_points = fineCenterlinePoints(lanelet_obj, resolution);
 
   // Create centerline
   lanelet::LineString3d centerline(lanelet::utils::getId());
-  for (int i = 0; i < num_segments + 1; i++) {
+  for (const auto & center_basic_point : center_points) {
     // Add ID for the average point of left and right
-    const auto center_basic_point = (right_points.at(i) + left_points.at(i)) / 2;
     const lanelet::Point3d center_point(
       lanelet::utils::getId(), center_basic_point.x(), center_basic_point.y(),
       center_basic_point.z());
@@ -512,35 +581,73 @@ lanelet::ConstLanelets getExpandedLanelets(
 }
 
 void overwriteLaneletsCenterline(
-  lanelet::LaneletMapPtr lanelet_map, const double resolution, const bool force_overwrite)
+  lanelet::LaneletMapPtr lanelet_map, const double resolution, const bool force_overwrite,
+  const std::size_t thread_count, CenterlineOverwriteStats * stats)
 {
+  std::vector<lanelet::Lanelet> lanelets;
   for (auto & lanelet_obj : lanelet_map->laneletLayer) {
     if (force_overwrite || !lanelet_obj.hasCustomCenterline()) {
-      const auto fine_center_line = deprecated::generateFineCenterline(lanelet_obj, resolution);
-      lanelet_obj.setCenterline(fine_center_line);
+      lanelets.push_back(lanelet_obj);
     }
   }
+  const auto overwrite_stats = overwriteCenterlines(lanelets, resolution, thread_count);
+  if (stats) {
+    *stats = overwrite_stats;
+  }
 }
 
 void overwriteLaneletsCenterlineWithWaypoints(
-  lanelet::LaneletMapPtr lanelet_map, const double resolution, const bool force_overwrite)
+  lanelet::LaneletMapPtr lanelet_map, const double resolution, const bool force_overwrite,
+  const std::size_t thread_count, CenterlineOverwriteStats * stats)
 {
+  std::vector<lanelet::Lanelet> lanelets;
   for (auto & lanelet_obj : lanelet_map->laneletLayer) {
-    if (force_overwrite) {
-      const auto fine_center_line = deprecated::generateFineCenterline(lanelet_obj, resolution);
-      lanelet_obj.setCenterline(fine_center_line);
-    } else {
-      if (lanelet_obj.hasCustomCenterline()) {
-        const auto & centerline = lanelet_obj.centerline();
-        lanelet_obj.setAttribute("waypoints", centerline.id());
-      }
-
-      const auto fine_center_line = deprecated::generateFineCenterline(lanelet_obj, resolution);
-      lanelet_obj.setCenterline(fine_center_line);
+    if (!force_overwrite && lanelet_obj.hasCustomCenterline()) {
+      const auto & centerline = lanelet_obj.centerline();
+      lanelet_obj.setAttribute("waypoints", centerline.id());
     }
+    lanelets.push_back(lanelet_obj);
+  }
+  const auto overwrite_stats = overwriteCenterlines(lanelets, resolution, thread_count);
+  if (stats) {
+    *stats = overwrite_stats;
   }
 }
 
+MapWarmUpStats warmUpMap(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const std::size_t thread_count,
+  LaneletGeometryCache * geometry_cache)
+{
+  MapWarmUpStats stats;
+  if (!lanelet_map) {
+    std::cerr << __FUNCTION__ << ": lanelet_map is null pointer!" << std::endl;
+    return stats;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  const auto elapsed_ms = [](const Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  };
+
+  // every lanelet of the layer owns its data, so no two threads compute the same centerline
+  const lanelet::ConstLanelets lanelets(
+    lanelet_map->laneletLayer.begin(), lanelet_map->laneletLayer.end());
+  stats.lanelets = lanelets.size();
+  constexpr std::size_t warm_up_chunk_size = 64;
+  const auto centerline_start = Clock::now();
+  impl::parallelFor(
+    lanelets.size(), [&](const std::size_t i) { lanelets[i].centerline(); }, warm_up_chunk_size,
+    thread_count);
+  stats.centerline_ms = elapsed_ms(centerline_start);
+
+  if (geometry_cache) {
+    const auto geometry_cache_start = Clock::now();
+    *geometry_cache = LaneletGeometryCache(lanelets, thread_count);
+    stats.geometry_cache_ms = elapsed_ms(geometry_cache_start);
+  }
+  return stats;
+}
+
 lanelet::ConstLanelets getConflictingLanelets(
   const lanelet::routing::RoutingGraphConstPtr & graph, const lanelet::ConstLanelet & lanelet)
 {
@@ -663,6 +770,26 @@ double getLaneletLength3d(const lanelet::ConstLanelets & lanelet_sequence)
   return length;
 }
 
+double getLaneletLength2d(
+  const lanelet::ConstLanelets & lanelet_sequence, const LaneletGeometryCache & geometry_cache)
+{
+  double length = 0;
+  for (const auto & llt : lanelet_sequence) {
+    length += geometry_cache.length2d(llt);
+  }
+  return length;
+}
+
+double getLaneletLength3d(
+  const lanelet::ConstLanelets & lanelet_sequence, const LaneletGeometryCache & geometry_cache)
+{
+  double length = 0;
+  for (const auto & llt : lanelet_sequence) {
+    length += geometry_cache.length3d(llt);
+  }
+  return length;
+}
+
 lanelet::ArcCoordinates getArcCoordinates(
   const lanelet::ConstLanelets & lanelet_sequence, const geometry_msgs::msg::Pose & pose)
 {
@@ -795,6 +922,22 @@ bool isInLanelet(
   return boost::geometry::distance(p, lanelet.polygon2d().basicPolygon()) < radius + eps;
 }
 
+bool isInLanelet(
+  const geometry_msgs::msg::Pose & current_pose, const lanelet::ConstLanelet & lanelet,
+  const LaneletGeometryCache & geometry_cache, const double radius)
+{
+  constexpr double eps = 1.0e-9;
+  const lanelet::BasicPoint2d p(current_pose.position.x, current_pose.position.y);
+  if (const auto * geometry = geometry_cache.find(lanelet)) {
+    // the polygon lies inside its bounding box, so the box is at most as far away
+    if (geometry->bounding_box.exteriorDistance(p) >= radius + eps) {
+      return false;
+    }
+    return boost::geometry::distance(p, geometry->polygon) < radius + eps;
+  }
+  return boost::geometry::distance(p, lanelet.polygon2d().basicPolygon()) < radius + eps;
+}
+
 geometry_msgs::msg::Pose getClosestCenterPose(
   const lanelet::ConstLanelet & lanelet, const geometry_msgs::msg::Point & search_point)
 {
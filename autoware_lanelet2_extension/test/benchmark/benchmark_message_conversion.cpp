@@ -0,0 +1,311 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "../../lib/bin_msg_routing_graph.hpp"
+#include "autoware_lanelet2_extension/traffic_rules/autoware_traffic_rules.hpp"
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+#include "synthetic_map.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/archive/binary_iarchive.hpp>
+#include <lanelet2_core/utility/Utilities.h>
+#include <lanelet2_io/io_handlers/Serialize.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+
+using lanelet::utils::conversion::BinMsgCompression;
+using lanelet::utils::conversion::BinMsgFormat;
+
+namespace
+{
+/// process wide heap statistics, updated by the replaced global operator new and delete below
+struct AllocationStats
+{
+  std::atomic<std::size_t> count{0};
+  std::atomic<std::size_t> live_bytes{0};
+  std::atomic<std::size_t> peak_bytes{0};
+};
+
+AllocationStats & allocationStats()
+{
+  static AllocationStats stats;
+  return stats;
+}
+
+void recordAllocation(void * ptr)
+{
+  auto & stats = allocationStats();
+  stats.count.fetch_add(1, std::memory_order_relaxed);
+  const auto size = malloc_usable_size(ptr);
+  const auto live = stats.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  auto peak = stats.peak_bytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !stats.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void recordDeallocation(void * ptr)
+{
+  allocationStats().live_bytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+}
+
+/// measures allocations between construction and report(), which adds them as counters
+class AllocationScope
+{
+public:
+  AllocationScope()
+  : count_(allocationStats().count.load()), live_bytes_(allocationStats().live_bytes.load())
+  {
+    allocationStats().peak_bytes.store(live_bytes_);
+  }
+
+  void report(benchmark::State & state) const
+  {
+    const auto & stats = allocationStats();
+    state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(stats.count.load() - count_), benchmark::Counter::kAvgIterations);
+    state.counters["peak_bytes"] =
+      static_cast<double>(std::max(stats.peak_bytes.load(), live_bytes_) - live_bytes_);
+  }
+
+private:
+  std::size_t count_;
+  std::size_t live_bytes_;
+};
+
+/// maps are cached by size, generating the largest one takes longer than encoding it
+const lanelet::LaneletMapPtr & syntheticMap(const std::size_t lanelets)
+{
+  static std::map<std::size_t, lanelet::LaneletMapPtr> maps;
+  auto & map = maps[lanelets];
+  if (!map) {
+    lanelet::utils::synthetic::SyntheticMapConfig config;
+    config.lanelets = lanelets;
+    config.polygons = lanelets / 10;
+    map = lanelet::utils::synthetic::makeSyntheticMap(config);
+  }
+  return map;
+}
+
+void setMapCounters(benchmark::State & state, const lanelet::LaneletMap & map)
+{
+  state.counters["lanelets"] = static_cast<double>(map.laneletLayer.size());
+  state.counters["regulatory_elements"] = static_cast<double>(map.regulatoryElementLayer.size());
+  state.counters["polygons"] = static_cast<double>(map.polygonLayer.size());
+}
+
+void BM_Encode(benchmark::State & state, BinMsgFormat format, BinMsgCompression compression)
+{
+  const auto & map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  autoware_map_msgs::msg::LaneletMapBin msg;
+
+  const AllocationScope allocations;
+  for (auto _ : state) {
+    lanelet::utils::conversion::toBinMsg(map, &msg, format, compression);
+    benchmark::DoNotOptimize(msg.data.data());
+  }
+  allocations.report(state);
+  setMapCounters(state, *map);
+  state.counters["payload_bytes"] = static_cast<double>(msg.data.size());
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * msg.data.size()));
+}
+
+void BM_Decode(benchmark::State & state, BinMsgFormat format, BinMsgCompression compression)
+{
+  const auto & map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(map, &msg, format, compression);
+
+  const AllocationScope allocations;
+  for (auto _ : state) {
+    auto decoded = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(
+      msg, decoded, lanelet::utils::conversion::BinMsgLayer::All);
+    benchmark::DoNotOptimize(decoded.get());
+    // the destruction of the map is not part of the decode time
+    state.PauseTiming();
+    decoded.reset();
+    state.ResumeTiming();
+  }
+  allocations.report(state);
+  setMapCounters(state, *map);
+  state.counters["payload_bytes"] = static_cast<double>(msg.data.size());
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * msg.data.size()));
+}
+
+/// baseline for BM_Decode/legacy: the decoder before payloads were read in place, which copied the
+/// payload into a string and the string into a stringstream before reading the archive
+void BM_Decode_copy(benchmark::State & state)
+{
+  const auto & map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(map, &msg, BinMsgFormat::Legacy);
+
+  const AllocationScope allocations;
+  for (auto _ : state) {
+    auto decoded = std::make_shared<lanelet::LaneletMap>();
+    std::string data_str;
+    data_str.assign(msg.data.begin(), msg.data.end());
+    std::stringstream ss;
+    ss << data_str;
+    boost::archive::binary_iarchive ia(ss);
+    ia >> *decoded;
+    lanelet::Id id_counter = 0;
+    ia >> id_counter;
+    lanelet::utils::registerId(id_counter);
+    benchmark::DoNotOptimize(decoded.get());
+    state.PauseTiming();
+    decoded.reset();
+    state.ResumeTiming();
+  }
+  allocations.report(state);
+  setMapCounters(state, *map);
+  state.counters["payload_bytes"] = static_cast<double>(msg.data.size());
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * msg.data.size()));
+}
+
+/// decodes a map and gets its routing graph with the default routing costs, restored from the
+/// payload if embedded is set and built otherwise
+void BM_DecodeRoutingGraph(benchmark::State & state, const bool embedded)
+{
+  const auto & map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  const lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
+    lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  if (embedded) {
+    const lanelet::routing::RoutingGraphConstPtr routing_graph =
+      lanelet::routing::RoutingGraph::build(*map, *traffic_rules);
+    lanelet::utils::conversion::toBinMsg(
+      map, routing_graph, *traffic_rules, &msg, BinMsgCompression::LZ4);
+  } else {
+    lanelet::utils::conversion::toBinMsg(map, &msg, BinMsgCompression::LZ4);
+  }
+
+  const AllocationScope allocations;
+  for (auto _ : state) {
+    auto decoded = std::make_shared<lanelet::LaneletMap>();
+    lanelet::routing::RoutingGraphPtr routing_graph;
+    lanelet::utils::conversion::fromBinMsg(msg, decoded, traffic_rules, &routing_graph);
+    benchmark::DoNotOptimize(routing_graph.get());
+    state.PauseTiming();
+    routing_graph.reset();
+    decoded.reset();
+    state.ResumeTiming();
+  }
+  allocations.report(state);
+  setMapCounters(state, *map);
+  state.counters["payload_bytes"] = static_cast<double>(msg.data.size());
+}
+
+/// what a subscriber spends on the traffic rules before it knows whether it can restore the graph.
+/// The map fingerprint is taken from the payload header, so only the rules are hashed
+void BM_RoutingGraphFingerprint(benchmark::State & state)
+{
+  const auto & map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+  const auto map_fingerprint = lanelet::utils::conversion::computeFingerprint(*map);
+
+  for (auto _ : state) {
+    auto fingerprint = lanelet::utils::conversion::impl::makeRoutingGraphFingerprint(
+      *map, *traffic_rules, map_fingerprint);
+    benchmark::DoNotOptimize(fingerprint.rules_fingerprint);
+  }
+  setMapCounters(state, *map);
+}
+
+void mapSizes(benchmark::internal::Benchmark * benchmark)
+{
+  benchmark->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+}
+
+/// building the routing graph of the largest map takes minutes
+void routingGraphMapSizes(benchmark::internal::Benchmark * benchmark)
+{
+  benchmark->RangeMultiplier(10)->Range(1000, 10000)->Unit(benchmark::kMillisecond);
+}
+}  // namespace
+
+void * operator new(std::size_t size)
+{
+  void * ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  recordAllocation(ptr);
+  return ptr;
+}
+
+void operator delete(void * ptr) noexcept
+{
+  if (ptr != nullptr) {
+    recordDeallocation(ptr);
+    std::free(ptr);
+  }
+}
+
+void operator delete(void * ptr, std::size_t /*size*/) noexcept
+{
+  operator delete(ptr);
+}
+
+BENCHMARK_CAPTURE(BM_Encode, legacy, BinMsgFormat::Legacy, BinMsgCompression::None)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Encode, boost_none, BinMsgFormat::Boost, BinMsgCompression::None)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Encode, boost_lz4, BinMsgFormat::Boost, BinMsgCompression::LZ4)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Encode, boost_zstd, BinMsgFormat::Boost, BinMsgCompression::Zstd)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Encode, flat_none, BinMsgFormat::Flat, BinMsgCompression::None)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Encode, flat_zstd, BinMsgFormat::Flat, BinMsgCompression::Zstd)
+  ->Apply(mapSizes);
+
+BENCHMARK(BM_Decode_copy)->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Decode, legacy, BinMsgFormat::Legacy, BinMsgCompression::None)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Decode, boost_none, BinMsgFormat::Boost, BinMsgCompression::None)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Decode, boost_lz4, BinMsgFormat::Boost, BinMsgCompression::LZ4)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Decode, boost_zstd, BinMsgFormat::Boost, BinMsgCompression::Zstd)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Decode, flat_none, BinMsgFormat::Flat, BinMsgCompression::None)
+  ->Apply(mapSizes);
+BENCHMARK_CAPTURE(BM_Decode, flat_zstd, BinMsgFormat::Flat, BinMsgCompression::Zstd)
+  ->Apply(mapSizes);
+
+BENCHMARK_CAPTURE(BM_DecodeRoutingGraph, built, false)->Apply(routingGraphMapSizes);
+BENCHMARK_CAPTURE(BM_DecodeRoutingGraph, restored, true)->Apply(routingGraphMapSizes);
+BENCHMARK(BM_RoutingGraphFingerprint)->Apply(routingGraphMapSizes);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND(readability-identifier-naming)
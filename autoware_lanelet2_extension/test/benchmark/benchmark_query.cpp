@@ -0,0 +1,269 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/traffic_rules/autoware_traffic_rules.hpp"
+#include "autoware_lanelet2_extension/utility/query.hpp"
+#include "autoware_lanelet2_extension/utility/utilities.hpp"
+#include "synthetic_map.hpp"
+
+#include <benchmark/benchmark.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <cstddef>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+/// maps are cached by size, generating the largest one takes longer than querying it
+const lanelet::LaneletMapPtr & syntheticMap(const std::size_t lanelets)
+{
+  static std::map<std::size_t, lanelet::LaneletMapPtr> maps;
+  auto & map = maps[lanelets];
+  if (!map) {
+    lanelet::utils::synthetic::SyntheticMapConfig config;
+    config.lanelets = lanelets;
+    map = lanelet::utils::synthetic::makeSyntheticMap(config);
+  }
+  return map;
+}
+
+/// poses spread over the whole road, a bit off the lanes so that some are outside every lanelet
+std::vector<geometry_msgs::msg::Pose> searchPoses(const lanelet::LaneletMap & map)
+{
+  lanelet::BoundingBox2d bounds;
+  for (const auto & llt : map.laneletLayer) {
+    bounds.extend(lanelet::geometry::boundingBox2d(llt));
+  }
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<double> x(bounds.min().x(), bounds.max().x());
+  std::uniform_real_distribution<double> y(bounds.min().y() - 2.0, bounds.max().y() + 2.0);
+  std::vector<geometry_msgs::msg::Pose> poses(256);
+  for (auto & pose : poses) {
+    pose.position.x = x(engine);
+    pose.position.y = y(engine);
+    pose.orientation.w = 1.0;
+  }
+  return poses;
+}
+
+void BM_GetClosestLaneletLinear(benchmark::State & state)
+{
+  const auto & map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  const auto lanelets = lanelet::utils::query::laneletLayer(map);
+  const auto poses = searchPoses(*map);
+
+  std::size_t i = 0;
+  lanelet::ConstLanelet closest_lanelet;
+  for (auto _ : state) {
+    const auto & pose = poses[i++ % poses.size()];
+    benchmark::DoNotOptimize(
+      lanelet::utils::query::getClosestLanelet(lanelets, pose, &closest_lanelet));
+  }
+}
+
+void BM_GetClosestLaneletIndexed(benchmark::State & state)
+{
+  const lanelet::LaneletMapConstPtr map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  const auto poses = searchPoses(*map);
+
+  std::size_t i = 0;
+  lanelet::ConstLanelet closest_lanelet;
+  for (auto _ : state) {
+    const auto & pose = poses[i++ % poses.size()];
+    benchmark::DoNotOptimize(
+      lanelet::utils::query::getClosestLanelet(map, pose, &closest_lanelet));
+  }
+}
+
+void BM_GetLaneletsWithinRange(benchmark::State & state)
+{
+  const lanelet::LaneletMapConstPtr map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  const auto poses = searchPoses(*map);
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto & position = poses[i++ % poses.size()].position;
+    benchmark::DoNotOptimize(lanelet::utils::query::getLaneletsWithinRange(
+      map, lanelet::BasicPoint2d(position.x, position.y), 10.0));
+  }
+}
+
+void BM_GetLaneletsWithinRangeCached(benchmark::State & state)
+{
+  const lanelet::LaneletMapConstPtr map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  const auto poses = searchPoses(*map);
+  const lanelet::utils::LaneletGeometryCache geometry_cache(map);
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto & position = poses[i++ % poses.size()].position;
+    benchmark::DoNotOptimize(lanelet::utils::query::getLaneletsWithinRange(
+      map, lanelet::BasicPoint2d(position.x, position.y), 10.0, geometry_cache));
+  }
+}
+
+void BM_BuildLaneletGeometryCache(benchmark::State & state)
+{
+  const lanelet::LaneletMapConstPtr map = syntheticMap(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lanelet::utils::LaneletGeometryCache(map));
+  }
+}
+
+void BM_OverwriteLaneletsCenterline(benchmark::State & state)
+{
+  // a map of its own, the other benchmarks should not see the overwritten centerlines
+  lanelet::utils::synthetic::SyntheticMapConfig config;
+  config.lanelets = static_cast<std::size_t>(state.range(0));
+  config.polygons = 0;
+  const auto map = lanelet::utils::synthetic::makeSyntheticMap(config);
+  const auto thread_count = static_cast<std::size_t>(state.range(1));
+
+  lanelet::utils::CenterlineOverwriteStats stats;
+  for (auto _ : state) {
+    lanelet::utils::overwriteLaneletsCenterline(map, 5.0, true, thread_count, &stats);
+  }
+  state.counters["points"] = static_cast<double>(stats.points);
+}
+
+struct JunctionGrid
+{
+  lanelet::LaneletMapPtr map;
+  lanelet::routing::RoutingGraphPtr graph;
+  lanelet::ConstLanelet first;  // rightmost lane, first segment
+  lanelet::ConstLanelet last;   // leftmost lane, last segment
+};
+
+/// 8 lanes of 20 segments, sequences branch at every segment until they reach the leftmost lane
+const JunctionGrid & junctionGrid()
+{
+  static const JunctionGrid grid = [] {
+    constexpr std::size_t lanes = 8;
+    constexpr std::size_t segments = 20;
+    constexpr double lanelet_length = 20.0;
+    constexpr double lane_width = 3.5;
+    JunctionGrid result;
+    result.map = lanelet::utils::synthetic::makeSyntheticJunctionGrid(
+      lanes, segments, lanelet_length, lane_width);
+    const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+    result.graph = lanelet::routing::RoutingGraph::build(*result.map, *traffic_rules);
+    const double end_x = segments * lanelet_length;
+    const double leftmost_lane_y = (lanes - 1) * lane_width;
+    for (const auto & llt : result.map->laneletLayer) {
+      const auto right = llt.rightBound();
+      if (right.front().y() != right.back().y()) {
+        continue;  // leads into another lane
+      }
+      if (right.front().x() == 0.0 && right.front().y() == 0.0) {
+        result.first = llt;
+      }
+      if (right.back().x() == end_x && right.back().y() == leftmost_lane_y) {
+        result.last = llt;
+      }
+    }
+    return result;
+  }();
+  return grid;
+}
+
+void BM_GetSucceedingLaneletSequencesRecursive(benchmark::State & state)
+{
+  const auto & grid = junctionGrid();
+  const auto length = static_cast<double>(state.range(0));
+  std::size_t sequences = 0;
+  for (auto _ : state) {
+    const auto result =
+      lanelet::utils::query::getSucceedingLaneletSequences(grid.graph, grid.first, length);
+    sequences = result.size();
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.counters["sequences"] = static_cast<double>(sequences);
+}
+
+void BM_EnumerateSucceedingLaneletSequences(benchmark::State & state)
+{
+  const auto & grid = junctionGrid();
+  const auto length = static_cast<double>(state.range(0));
+  std::size_t sequences = 0;
+  for (auto _ : state) {
+    const auto result =
+      lanelet::utils::query::enumerateSucceedingLaneletSequences(grid.graph, grid.first, length);
+    sequences = result.size();
+    benchmark::DoNotOptimize(result.lanelets.data());
+  }
+  state.counters["sequences"] = static_cast<double>(sequences);
+}
+
+void BM_GetPrecedingLaneletSequencesRecursive(benchmark::State & state)
+{
+  const auto & grid = junctionGrid();
+  const auto length = static_cast<double>(state.range(0));
+  std::size_t sequences = 0;
+  for (auto _ : state) {
+    const auto result =
+      lanelet::utils::query::getPrecedingLaneletSequences(grid.graph, grid.last, length);
+    sequences = result.size();
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.counters["sequences"] = static_cast<double>(sequences);
+}
+
+void BM_EnumeratePrecedingLaneletSequences(benchmark::State & state)
+{
+  const auto & grid = junctionGrid();
+  const auto length = static_cast<double>(state.range(0));
+  std::size_t sequences = 0;
+  for (auto _ : state) {
+    const auto result =
+      lanelet::utils::query::enumeratePrecedingLaneletSequences(grid.graph, grid.last, length);
+    sequences = result.size();
+    benchmark::DoNotOptimize(result.lanelets.data());
+  }
+  state.counters["sequences"] = static_cast<double>(sequences);
+}
+
+void mapSizes(benchmark::internal::Benchmark * benchmark)
+{
+  benchmark->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+}
+
+void sequenceLengths(benchmark::internal::Benchmark * benchmark)
+{
+  benchmark->DenseRange(100, 300, 100)->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+BENCHMARK(BM_GetClosestLaneletLinear)->Apply(mapSizes);
+BENCHMARK(BM_GetClosestLaneletIndexed)->Apply(mapSizes);
+BENCHMARK(BM_GetLaneletsWithinRange)->Apply(mapSizes);
+BENCHMARK(BM_GetLaneletsWithinRangeCached)->Apply(mapSizes);
+BENCHMARK(BM_BuildLaneletGeometryCache)->Apply(mapSizes);
+BENCHMARK(BM_OverwriteLaneletsCenterline)
+  ->ArgsProduct({{10000, 40000}, {1, 4}})
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetSucceedingLaneletSequencesRecursive)->Apply(sequenceLengths);
+BENCHMARK(BM_EnumerateSucceedingLaneletSequences)->Apply(sequenceLengths);
+BENCHMARK(BM_GetPrecedingLaneletSequencesRecursive)->Apply(sequenceLengths);
+BENCHMARK(BM_EnumeratePrecedingLaneletSequences)->Apply(sequenceLengths);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND(readability-identifier-naming)
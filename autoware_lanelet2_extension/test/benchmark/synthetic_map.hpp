@@ -0,0 +1,177 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#ifndef AUTOWARE_LANELET2_EXTENSION__TEST__BENCHMARK__SYNTHETIC_MAP_HPP_
+#define AUTOWARE_LANELET2_EXTENSION__TEST__BENCHMARK__SYNTHETIC_MAP_HPP_
+
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace lanelet::utils::synthetic
+{
+/**
+ * [SyntheticMapConfig describes a grid of straight parallel lanes along the x axis. Consecutive
+ * lanelets of a lane and neighboring lanes share their bounds, like in a real road network]
+ */
+struct SyntheticMapConfig
+{
+  std::size_t lanelets{1000};
+  std::size_t lanes{4};
+  std::size_t points_per_bound{10};
+  std::size_t regulatory_element_interval{10};  // one traffic light every n lanelets, 0 for none
+  std::size_t polygons{100};                    // pose marker polygons
+  double lanelet_length{20.0};
+  double lane_width{3.5};
+};
+
+/**
+ * [makeSyntheticMap builds a map of config.lanelets road lanelets (rounded up to full rows of
+ * lanes) with ids taken from lanelet::utils::getId()]
+ */
+inline lanelet::LaneletMapPtr makeSyntheticMap(const SyntheticMapConfig & config)
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  const std::size_t lanes = std::max<std::size_t>(1, config.lanes);
+  const std::size_t segments = (config.lanelets + lanes - 1) / lanes;
+  const std::size_t points_per_bound = std::max<std::size_t>(2, config.points_per_bound);
+
+  // bound endpoints are shared between consecutive segments
+  std::vector<lanelet::Point3d> start_points;
+  for (std::size_t b = 0; b <= lanes; ++b) {
+    start_points.emplace_back(lanelet::utils::getId(), 0.0, config.lane_width * b, 0.0);
+  }
+
+  std::size_t lanelet_index = 0;
+  for (std::size_t s = 0; s < segments; ++s) {
+    const double x_begin = config.lanelet_length * s;
+    std::vector<lanelet::LineString3d> bounds;
+    std::vector<lanelet::Point3d> end_points;
+    for (std::size_t b = 0; b <= lanes; ++b) {
+      const double y = config.lane_width * b;
+      lanelet::Points3d points{start_points[b]};
+      for (std::size_t p = 1; p + 1 < points_per_bound; ++p) {
+        const double x = x_begin + config.lanelet_length * p / (points_per_bound - 1);
+        points.emplace_back(lanelet::utils::getId(), x, y, 0.0);
+      }
+      end_points.emplace_back(lanelet::utils::getId(), x_begin + config.lanelet_length, y, 0.0);
+      points.push_back(end_points.back());
+      lanelet::LineString3d bound(lanelet::utils::getId(), points);
+      bound.attributes()[lanelet::AttributeName::Type] = lanelet::AttributeValueString::LineThin;
+      bound.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Dashed;
+      bounds.push_back(bound);
+    }
+
+    for (std::size_t l = 0; l < lanes; ++l) {
+      lanelet::Lanelet lanelet(lanelet::utils::getId(), bounds[l + 1], bounds[l]);
+      lanelet.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+      lanelet.attributes()[lanelet::AttributeName::SpeedLimit] = "50";
+
+      if (
+        config.regulatory_element_interval != 0 &&
+        lanelet_index % config.regulatory_element_interval == 0) {
+        const lanelet::LineString3d stop_line(
+          lanelet::utils::getId(), lanelet::Points3d{end_points[l], end_points[l + 1]});
+        const lanelet::LineString3d light(
+          lanelet::utils::getId(),
+          lanelet::Points3d{
+            lanelet::Point3d(lanelet::utils::getId(), end_points[l].x(), end_points[l].y(), 5.0),
+            lanelet::Point3d(
+              lanelet::utils::getId(), end_points[l + 1].x(), end_points[l + 1].y(), 5.0)});
+        lanelet.addRegulatoryElement(lanelet::autoware::AutowareTrafficLight::make(
+          lanelet::utils::getId(), lanelet::AttributeMap(), {light}, stop_line, {}));
+      }
+      map->add(lanelet);
+      ++lanelet_index;
+    }
+    start_points = end_points;
+  }
+
+  const double road_length = config.lanelet_length * segments;
+  for (std::size_t i = 0; i < config.polygons; ++i) {
+    const double x = road_length * i / std::max<std::size_t>(1, config.polygons);
+    const double y = -2.0;
+    lanelet::Polygon3d marker(
+      lanelet::utils::getId(),
+      {lanelet::Point3d(lanelet::utils::getId(), x, y, 0.0),
+       lanelet::Point3d(lanelet::utils::getId(), x + 0.5, y, 0.0),
+       lanelet::Point3d(lanelet::utils::getId(), x + 0.5, y + 0.5, 0.0),
+       lanelet::Point3d(lanelet::utils::getId(), x, y + 0.5, 0.0)});
+    marker.attributes()[lanelet::AttributeName::Type] = "pose_marker";
+    marker.attributes()[lanelet::AttributeName::Subtype] = "apriltag_16h5";
+    map->add(marker);
+  }
+  return map;
+}
+
+inline lanelet::Lanelet makeRoadLanelet(
+  const lanelet::LineString3d & left, const lanelet::LineString3d & right)
+{
+  lanelet::Lanelet llt(lanelet::utils::getId(), left, right);
+  llt.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+  llt.attributes()[lanelet::AttributeName::SpeedLimit] = "50";
+  return llt;
+}
+
+/**
+ * [makeSyntheticJunctionGrid builds `lanes` parallel lanes of `segments` road lanelets along the x
+ * axis. Every lanelet except those of the leftmost lane is also followed by a lanelet leading into
+ * the lane on its left, so the number of lanelet sequences grows exponentially with their length,
+ * like in a dense network of junctions]
+ */
+inline lanelet::LaneletMapPtr makeSyntheticJunctionGrid(
+  const std::size_t lanes, const std::size_t segments, const double lanelet_length = 20.0,
+  const double lane_width = 3.5)
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  std::vector<lanelet::Point3d> start_points;
+  for (std::size_t b = 0; b <= lanes; ++b) {
+    start_points.emplace_back(lanelet::utils::getId(), 0.0, lane_width * b, 0.0);
+  }
+  for (std::size_t s = 0; s < segments; ++s) {
+    std::vector<lanelet::Point3d> end_points;
+    std::vector<lanelet::LineString3d> bounds;
+    for (std::size_t b = 0; b <= lanes; ++b) {
+      end_points.emplace_back(
+        lanelet::utils::getId(), lanelet_length * (s + 1), lane_width * b, 0.0);
+      bounds.emplace_back(
+        lanelet::utils::getId(), lanelet::Points3d{start_points[b], end_points[b]});
+    }
+    for (std::size_t l = 0; l < lanes; ++l) {
+      map->add(makeRoadLanelet(bounds[l + 1], bounds[l]));
+    }
+    for (std::size_t l = 0; l + 1 < lanes; ++l) {
+      const lanelet::LineString3d left(
+        lanelet::utils::getId(), lanelet::Points3d{start_points[l + 1], end_points[l + 2]});
+      const lanelet::LineString3d right(
+        lanelet::utils::getId(), lanelet::Points3d{start_points[l], end_points[l + 1]});
+      map->add(makeRoadLanelet(left, right));
+    }
+    start_points = end_points;
+  }
+  return map;
+}
+}  // namespace lanelet::utils::synthetic
+
+#endif  // AUTOWARE_LANELET2_EXTENSION__TEST__BENCHMARK__SYNTHETIC_MAP_HPP_
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,128 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/ego_lanelet_tracker.hpp"
+
+#include "../benchmark/synthetic_map.hpp"
+#include "autoware_lanelet2_extension/traffic_rules/autoware_traffic_rules.hpp"
+#include "autoware_lanelet2_extension/utility/query.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+class EgoLaneletTrackerTest : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  EgoLaneletTrackerTest()
+  {
+    // two lanes of three 20m long lanelets along the x axis, the left lane at y in [3.5, 7]
+    lanelet::utils::synthetic::SyntheticMapConfig config;
+    config.lanelets = 6;
+    config.lanes = 2;
+    config.regulatory_element_interval = 0;
+    config.polygons = 0;
+    map_ptr = lanelet::utils::synthetic::makeSyntheticMap(config);
+
+    const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+    routing_graph = lanelet::routing::RoutingGraph::build(*map_ptr, *traffic_rules);
+  }
+
+  ~EgoLaneletTrackerTest() override = default;
+
+  static geometry_msgs::msg::Pose pose(const double x, const double y)
+  {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = x;
+    pose.position.y = y;
+    pose.orientation.w = 1.0;
+    return pose;
+  }
+
+  lanelet::Id laneletAt(const double x, const double y) const
+  {
+    lanelet::ConstLanelets lanelets;
+    lanelet::utils::query::getCurrentLanelets(map_ptr, pose(x, y), &lanelets);
+    return lanelets.size() == 1 ? lanelets.front().id() : lanelet::InvalId;
+  }
+
+  lanelet::LaneletMapPtr map_ptr;
+  lanelet::routing::RoutingGraphConstPtr routing_graph;
+};
+
+TEST_F(EgoLaneletTrackerTest, FollowsEgoThroughTheGraph)  // NOLINT for gtest
+{
+  lanelet::utils::EgoLaneletTracker tracker(map_ptr, routing_graph);
+  lanelet::ConstLanelet lanelet;
+
+  // without a previous lanelet the global search is used
+  ASSERT_TRUE(tracker.update(pose(5.0, 1.75), &lanelet));
+  EXPECT_FALSE(tracker.lastUpdateWasLocal());
+  EXPECT_EQ(laneletAt(5.0, 1.75), lanelet.id());
+
+  // following lanelet
+  ASSERT_TRUE(tracker.update(pose(25.0, 1.75), &lanelet));
+  EXPECT_TRUE(tracker.lastUpdateWasLocal());
+  EXPECT_EQ(laneletAt(25.0, 1.75), lanelet.id());
+
+  // lane change to the left
+  ASSERT_TRUE(tracker.update(pose(25.0, 5.25), &lanelet));
+  EXPECT_TRUE(tracker.lastUpdateWasLocal());
+  EXPECT_EQ(laneletAt(25.0, 5.25), lanelet.id());
+  ASSERT_TRUE(tracker.currentLanelet());
+  EXPECT_EQ(lanelet.id(), tracker.currentLanelet()->id());
+
+  // a jump out of the neighborhood falls back to the global search
+  ASSERT_TRUE(tracker.update(pose(55.0, 1.75), &lanelet));
+  EXPECT_FALSE(tracker.lastUpdateWasLocal());
+  EXPECT_EQ(laneletAt(55.0, 1.75), lanelet.id());
+}
+
+TEST_F(EgoLaneletTrackerTest, ThresholdsLimitTheGlobalSearch)  // NOLINT for gtest
+{
+  lanelet::utils::EgoLaneletTracker tracker(map_ptr, routing_graph, 1.0, 0.5);
+  lanelet::ConstLanelet lanelet;
+
+  ASSERT_TRUE(tracker.update(pose(5.0, 1.75), &lanelet));
+  const auto start_id = lanelet.id();
+
+  // driving backwards is not within the yaw threshold of any lanelet
+  auto backwards = pose(25.0, 1.75);
+  backwards.orientation.w = 0.0;
+  backwards.orientation.z = 1.0;
+  EXPECT_FALSE(tracker.update(backwards, &lanelet));
+  EXPECT_EQ(start_id, lanelet.id());
+  EXPECT_FALSE(tracker.currentLanelet());
+
+  // far off the road
+  EXPECT_FALSE(tracker.update(pose(5.0, 20.0), &lanelet));
+
+  tracker.setCurrentLanelet(map_ptr->laneletLayer.get(start_id));
+  ASSERT_TRUE(tracker.update(pose(6.0, 1.75), &lanelet));
+  EXPECT_TRUE(tracker.lastUpdateWasLocal());
+  tracker.reset();
+  EXPECT_FALSE(tracker.currentLanelet());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
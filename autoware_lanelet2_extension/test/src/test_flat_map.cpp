@@ -0,0 +1,246 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/io/flat_map.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+#include "autoware_lanelet2_extension/utility/query.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::Points3d;
+using lanelet::utils::getId;
+
+class TestSuite : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  TestSuite() : sample_map_ptr(new lanelet::LaneletMap())
+  {
+    // create sample lanelets
+    const Point3d p1(getId(), 0.0, 0.0, 0.0);
+    const Point3d p2(getId(), 0.0, 10.0, 0.0);
+    const Point3d p3(getId(), 3.0, 0.0, 0.0);
+    const Point3d p4(getId(), 3.0, 10.0, 0.0);
+    const Point3d p5(getId(), 100.0, 0.0, 0.0);
+    const Point3d p6(getId(), 100.0, 10.0, 0.0);
+    const Point3d p7(getId(), 103.0, 0.0, 0.0);
+    const Point3d p8(getId(), 103.0, 10.0, 0.0);
+
+    const LineString3d ls_left(getId(), {p1, p2});
+    const LineString3d ls_right(getId(), {p3, p4});
+    const LineString3d ls_left_far(getId(), {p5, p6});
+    // stored in reverse so that the lanelet refers to it inverted
+    const LineString3d ls_right_far(getId(), {p8, p7});
+
+    road_lanelet = Lanelet(getId(), ls_left, ls_right);
+    road_lanelet.attributes()[lanelet::AttributeName::Subtype] =
+      lanelet::AttributeValueString::Road;
+    far_lanelet = Lanelet(getId(), ls_left_far, ls_right_far.invert());
+    far_lanelet.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+
+    // custom centerline, not part of the linestring layer
+    const Point3d c1(getId(), 1.5, 0.0, 0.0);
+    const Point3d c2(getId(), 1.5, 10.0, 0.0);
+    centerline = LineString3d(getId(), {c1, c2});
+    road_lanelet.setCenterline(centerline);
+
+    // create sample traffic light
+    const Point3d p9(getId(), 0.0, 10.0, 4.0);
+    const Point3d p10(getId(), 3.0, 10.0, 4.0);
+    const LineString3d traffic_light_base(getId(), Points3d{p9, p10});
+    const LineString3d stop_line(getId(), Points3d{p2, p4});
+    auto tl = lanelet::autoware::AutowareTrafficLight::make(
+      getId(), lanelet::AttributeMap(), {traffic_light_base}, stop_line, {});
+    road_lanelet.addRegulatoryElement(tl);
+
+    sample_map_ptr->add(road_lanelet);
+    sample_map_ptr->add(far_lanelet);
+  }
+
+  ~TestSuite() override = default;
+
+  lanelet::LaneletMapPtr sample_map_ptr;
+  Lanelet road_lanelet;
+  Lanelet far_lanelet;
+  LineString3d centerline;
+
+private:
+};
+
+TEST_F(TestSuite, RoundTrip)  // NOLINT for gtest
+{
+  std::vector<std::uint8_t> data;
+  lanelet::io_handlers::writeFlatMap(*sample_map_ptr, &data);
+  const lanelet::io_handlers::FlatMapView view(data.data(), data.size());
+
+  EXPECT_EQ(sample_map_ptr->laneletLayer.size(), view.lanelets().size());
+  EXPECT_EQ(sample_map_ptr->regulatoryElementLayer.size(), view.regulatoryElements().size());
+  ASSERT_TRUE(view.findLanelet(road_lanelet.id()).has_value());
+  EXPECT_FALSE(view.findLanelet(-1).has_value());
+
+  const auto map = lanelet::io_handlers::materialize(view);
+  EXPECT_EQ(sample_map_ptr->pointLayer.size(), map->pointLayer.size());
+  EXPECT_EQ(sample_map_ptr->lineStringLayer.size(), map->lineStringLayer.size());
+  EXPECT_EQ(sample_map_ptr->laneletLayer.size(), map->laneletLayer.size());
+  EXPECT_EQ(sample_map_ptr->regulatoryElementLayer.size(), map->regulatoryElementLayer.size());
+
+  const auto road = map->laneletLayer.get(road_lanelet.id());
+  ASSERT_TRUE(road.hasCustomCenterline());
+  EXPECT_EQ(centerline.id(), road.centerline().id());
+  EXPECT_FALSE(map->lineStringLayer.exists(centerline.id()));
+  EXPECT_EQ(
+    road_lanelet.attributeOr(lanelet::AttributeName::Subtype, "none"),
+    road.attributeOr(lanelet::AttributeName::Subtype, "none"));
+  ASSERT_EQ(1U, road.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>().size());
+
+  const auto far = map->laneletLayer.get(far_lanelet.id());
+  EXPECT_EQ(far_lanelet.rightBound().inverted(), far.rightBound().inverted());
+  EXPECT_DOUBLE_EQ(far_lanelet.rightBound().front().x(), far.rightBound().front().x());
+  EXPECT_DOUBLE_EQ(far_lanelet.rightBound().front().y(), far.rightBound().front().y());
+}
+
+TEST_F(TestSuite, MaterializeWithin)  // NOLINT for gtest
+{
+  std::vector<std::uint8_t> data;
+  lanelet::io_handlers::writeFlatMap(*sample_map_ptr, &data);
+  const lanelet::io_handlers::FlatMapView view(data.data(), data.size());
+
+  const lanelet::BoundingBox2d box(
+    lanelet::BasicPoint2d(-1.0, -1.0), lanelet::BasicPoint2d(5.0, 5.0));
+  const auto map = lanelet::io_handlers::materializeWithin(view, box);
+  ASSERT_EQ(1U, map->laneletLayer.size());
+  EXPECT_TRUE(map->laneletLayer.exists(road_lanelet.id()));
+
+  // the subset can be handed to the query functions
+  const auto road_lanelets =
+    lanelet::utils::query::roadLanelets(lanelet::utils::query::laneletLayer(map));
+  EXPECT_EQ(1U, road_lanelets.size());
+  EXPECT_EQ(1U, lanelet::utils::query::autowareTrafficLights(road_lanelets).size());
+}
+
+TEST(FlatMap, ParallelMaterializeOfLargeMap)  // NOLINT for gtest
+{
+  // enough records per section for the sections to be split across threads
+  constexpr int lanelet_count = 5000;
+  lanelet::LaneletMap source;
+  Points3d left_points{Point3d(getId(), 0.0, 0.0, 0.0), Point3d(getId(), 0.0, 3.0, 0.0)};
+  for (int i = 0; i < lanelet_count; ++i) {
+    const double x = 10.0 * (i + 1);
+    const Points3d right_points{Point3d(getId(), x, 0.0, 0.0), Point3d(getId(), x, 3.0, 0.0)};
+    Lanelet lanelet(
+      getId(), LineString3d(getId(), left_points), LineString3d(getId(), right_points));
+    if (i % 10 == 0) {
+      const LineString3d stop_line(getId(), right_points);
+      lanelet.addRegulatoryElement(lanelet::autoware::AutowareTrafficLight::make(
+        getId(), lanelet::AttributeMap(), {LineString3d(getId(), right_points)}, stop_line, {}));
+    }
+    source.add(lanelet);
+    left_points = right_points;
+  }
+
+  std::vector<std::uint8_t> data;
+  lanelet::io_handlers::writeFlatMap(source, &data);
+  const lanelet::io_handlers::FlatMapView view(data.data(), data.size());
+  const auto map = lanelet::io_handlers::materialize(view);
+
+  EXPECT_EQ(source.pointLayer.size(), map->pointLayer.size());
+  EXPECT_EQ(source.lineStringLayer.size(), map->lineStringLayer.size());
+  EXPECT_EQ(source.laneletLayer.size(), map->laneletLayer.size());
+  EXPECT_EQ(source.regulatoryElementLayer.size(), map->regulatoryElementLayer.size());
+  for (const auto & expected : source.laneletLayer) {
+    ASSERT_TRUE(map->laneletLayer.exists(expected.id()));
+    const auto actual = map->laneletLayer.get(expected.id());
+    EXPECT_EQ(expected.leftBound().id(), actual.leftBound().id());
+    EXPECT_EQ(expected.rightBound().id(), actual.rightBound().id());
+    EXPECT_DOUBLE_EQ(expected.rightBound().front().x(), actual.rightBound().front().x());
+    ASSERT_EQ(expected.regulatoryElements().size(), actual.regulatoryElements().size());
+    // shared points are materialized once
+    EXPECT_EQ(
+      actual.leftBound().front().constData(),
+      map->pointLayer.get(expected.leftBound().front().id()).constData());
+  }
+}
+
+TEST_F(TestSuite, RoundTripOfUntypedRegulatoryElements)  // NOLINT for gtest
+{
+  const Point3d p1(getId(), 0.0, 10.0, 0.0);
+  const Point3d p2(getId(), 3.0, 10.0, 0.0);
+  const LineString3d line(getId(), Points3d{p1, p2});
+  lanelet::RuleParameterMap parameters;
+  parameters[lanelet::RoleNameString::RefLine].push_back(line);
+
+  // no subtype at all
+  const auto untyped = std::make_shared<lanelet::GenericRegulatoryElement>(getId(), parameters);
+  // the subtype is known, but the traffic light constructor throws without a light to refer to
+  lanelet::AttributeMap attributes;
+  attributes[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::TrafficLight;
+  const auto invalid =
+    std::make_shared<lanelet::GenericRegulatoryElement>(getId(), parameters, attributes);
+  road_lanelet.addRegulatoryElement(untyped);
+  road_lanelet.addRegulatoryElement(invalid);
+  sample_map_ptr->add(untyped);
+  sample_map_ptr->add(invalid);
+
+  std::vector<std::uint8_t> data;
+  lanelet::io_handlers::writeFlatMap(*sample_map_ptr, &data);
+  const lanelet::io_handlers::FlatMapView view(data.data(), data.size());
+  const auto map = lanelet::io_handlers::materialize(view);
+
+  ASSERT_EQ(sample_map_ptr->regulatoryElementLayer.size(), map->regulatoryElementLayer.size());
+  for (const auto id : {untyped->id(), invalid->id()}) {
+    ASSERT_TRUE(map->regulatoryElementLayer.exists(id));
+    const auto regulatory_element = map->regulatoryElementLayer.get(id);
+    ASSERT_NE(nullptr, regulatory_element);
+    EXPECT_NE(
+      nullptr, std::dynamic_pointer_cast<lanelet::GenericRegulatoryElement>(regulatory_element));
+    const auto ref_lines =
+      regulatory_element->getParameters<lanelet::ConstLineString3d>(lanelet::RoleName::RefLine);
+    ASSERT_EQ(1U, ref_lines.size());
+    EXPECT_EQ(line.id(), ref_lines.front().id());
+  }
+  EXPECT_EQ(3U, map->laneletLayer.get(road_lanelet.id()).regulatoryElements().size());
+}
+
+TEST_F(TestSuite, RejectsMalformedBuffer)  // NOLINT for gtest
+{
+  std::vector<std::uint8_t> data;
+  lanelet::io_handlers::writeFlatMap(*sample_map_ptr, &data);
+
+  EXPECT_ANY_THROW(lanelet::io_handlers::FlatMapView(data.data(), 8));
+
+  auto broken = data;
+  broken[0] = 'X';
+  EXPECT_ANY_THROW(lanelet::io_handlers::FlatMapView(broken.data(), broken.size()));
+
+  auto truncated = data;
+  truncated.resize(truncated.size() / 2);
+  EXPECT_ANY_THROW(lanelet::io_handlers::FlatMapView(truncated.data(), truncated.size()));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,132 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/lanelet_geometry_cache.hpp"
+
+#include "../benchmark/synthetic_map.hpp"
+#include "autoware_lanelet2_extension/utility/query.hpp"
+#include "autoware_lanelet2_extension/utility/utilities.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <cstddef>
+
+class LaneletGeometryCacheTest : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  LaneletGeometryCacheTest()
+  {
+    lanelet::utils::synthetic::SyntheticMapConfig config;
+    config.lanelets = 400;
+    config.points_per_bound = 5;
+    config.polygons = 0;
+    sample_map_ptr = lanelet::utils::synthetic::makeSyntheticMap(config);
+  }
+
+  ~LaneletGeometryCacheTest() override = default;
+
+  lanelet::LaneletMapConstPtr sample_map_ptr;
+};
+
+TEST_F(LaneletGeometryCacheTest, EmptyCache)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletGeometryCache cache;
+  EXPECT_TRUE(cache.empty());
+
+  const auto & llt = *sample_map_ptr->laneletLayer.begin();
+  EXPECT_EQ(nullptr, cache.find(llt));
+  EXPECT_DOUBLE_EQ(lanelet::geometry::length2d(llt), cache.length2d(llt));
+  EXPECT_DOUBLE_EQ(lanelet::geometry::length3d(llt), cache.length3d(llt));
+}
+
+TEST_F(LaneletGeometryCacheTest, MatchesGeometry)  // NOLINT for gtest
+{
+  // the lanelets are split into several blocks, so they are computed by several threads
+  const lanelet::utils::LaneletGeometryCache cache(sample_map_ptr, 4);
+  ASSERT_EQ(sample_map_ptr->laneletLayer.size(), cache.size());
+
+  for (const auto & llt : sample_map_ptr->laneletLayer) {
+    const auto * geometry = cache.find(llt);
+    ASSERT_NE(nullptr, geometry);
+    EXPECT_NEAR(lanelet::geometry::length2d(llt), geometry->length2d, 1e-9);
+    EXPECT_NEAR(lanelet::geometry::length3d(llt), geometry->length3d, 1e-9);
+    EXPECT_TRUE(lanelet::geometry::boundingBox2d(llt).isApprox(geometry->bounding_box));
+    EXPECT_EQ(llt.polygon2d().basicPolygon(), geometry->polygon);
+  }
+}
+
+TEST_F(LaneletGeometryCacheTest, InvertedAndDuplicateLanelets)  // NOLINT for gtest
+{
+  const auto & llt = *sample_map_ptr->laneletLayer.begin();
+  const lanelet::utils::LaneletGeometryCache cache(lanelet::ConstLanelets{llt.invert(), llt, llt});
+  EXPECT_EQ(1U, cache.size());
+
+  // the geometry is stored in the orientation of the map
+  ASSERT_NE(nullptr, cache.find(llt));
+  EXPECT_EQ(llt.polygon2d().basicPolygon(), cache.find(llt)->polygon);
+  EXPECT_EQ(nullptr, cache.find(llt.invert()));
+  EXPECT_DOUBLE_EQ(cache.length2d(llt), cache.length2d(llt.invert()));
+}
+
+TEST_F(LaneletGeometryCacheTest, CachedQueries)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletGeometryCache cache(sample_map_ptr);
+  const lanelet::BasicPoint2d search_point(105.0, 4.0);
+  EXPECT_EQ(
+    lanelet::utils::query::getLaneletsWithinRange(sample_map_ptr, search_point, 5.0),
+    lanelet::utils::query::getLaneletsWithinRange(sample_map_ptr, search_point, 5.0, cache));
+
+  const auto lanelets = lanelet::utils::query::laneletLayer(sample_map_ptr);
+  const lanelet::utils::LaneletSubsetIndex index(lanelets);
+  geometry_msgs::msg::Pose search_pose;
+  search_pose.position.x = search_point.x();
+  search_pose.position.y = search_point.y();
+  search_pose.orientation.w = 1.0;
+  lanelet::ConstLanelet closest_lanelet;
+  ASSERT_TRUE(
+    lanelet::utils::query::getClosestLaneletWithConstrains(index, search_pose, &closest_lanelet));
+  EXPECT_TRUE(lanelet::utils::isInLanelet(search_pose, closest_lanelet, cache));
+  search_pose.position.y = -1.0;
+  EXPECT_FALSE(lanelet::utils::isInLanelet(search_pose, closest_lanelet, cache));
+  EXPECT_TRUE(lanelet::utils::isInLanelet(search_pose, closest_lanelet, cache, 6.0));
+  // rejected by the bounding box alone
+  search_pose.position.y = -50.0;
+  EXPECT_FALSE(lanelet::utils::isInLanelet(search_pose, closest_lanelet, cache, 6.0));
+  // points diagonal to the lanelets, where the search box of the map is looser than the range
+  for (const double range : {1.0, 3.0, 8.0}) {
+    const lanelet::BasicPoint2d corner(100.0 - range * 0.8, -range * 0.8);
+    EXPECT_EQ(
+      lanelet::utils::query::getLaneletsWithinRange(sample_map_ptr, corner, range),
+      lanelet::utils::query::getLaneletsWithinRange(sample_map_ptr, corner, range, cache));
+  }
+
+  double length = 0.0;
+  for (const auto & llt : lanelets) {
+    length += lanelet::geometry::length2d(llt);
+  }
+  EXPECT_NEAR(length, lanelet::utils::getLaneletLength2d(lanelets, cache), 1e-6);
+  EXPECT_NEAR(length, lanelet::utils::getLaneletLength3d(lanelets, cache), 1e-6);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
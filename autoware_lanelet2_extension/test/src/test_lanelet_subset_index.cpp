@@ -0,0 +1,208 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/lanelet_subset_index.hpp"
+
+#include "autoware_lanelet2_extension/utility/query.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::utils::getId;
+
+class LaneletSubsetIndexTest : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  LaneletSubsetIndexTest()
+  {
+    // three neighboring 3m wide lanes along the y axis and one lane far to the right
+    for (const double x : {0.0, 3.0, 6.0, 100.0}) {
+      const LineString3d left(
+        getId(), {Point3d(getId(), x, 0.0, 0.0), Point3d(getId(), x, 10.0, 0.0)});
+      const LineString3d right(
+        getId(), {Point3d(getId(), x + 3.0, 0.0, 0.0), Point3d(getId(), x + 3.0, 10.0, 0.0)});
+      lanelets.push_back(Lanelet(getId(), left, right));
+    }
+    // the second lane is given twice in opposite direction, like a bidirectional lane
+    lanelets.push_back(lanelets[1].invert());
+  }
+
+  ~LaneletSubsetIndexTest() override = default;
+
+  lanelet::ConstLanelets lanelets;
+};
+
+TEST_F(LaneletSubsetIndexTest, EmptyIndex)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletSubsetIndex index;
+  EXPECT_TRUE(index.empty());
+  EXPECT_TRUE(index.contains(lanelet::BasicPoint2d(0.0, 0.0)).empty());
+  EXPECT_TRUE(index.nearest(lanelet::BasicPoint2d(0.0, 0.0), 3).empty());
+  EXPECT_TRUE(index.withinRange(lanelet::BasicPoint2d(0.0, 0.0), 100.0).empty());
+}
+
+TEST_F(LaneletSubsetIndexTest, Contains)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletSubsetIndex index(lanelets);
+  ASSERT_EQ(lanelets.size(), index.size());
+
+  const auto found = index.contains(lanelet::BasicPoint2d(4.5, 5.0));
+  ASSERT_EQ(2U, found.size());
+  EXPECT_EQ(lanelets[1], found[0]);
+  EXPECT_EQ(lanelets[4], found[1]);
+
+  EXPECT_TRUE(index.contains(lanelet::BasicPoint2d(50.0, 5.0)).empty());
+
+  for (double x = -1.1; x < 105.0; x += 0.7) {
+    for (double y = -1.1; y < 12.0; y += 0.7) {
+      const lanelet::BasicPoint2d point(x, y);
+      lanelet::ConstLanelets expected;
+      for (const auto & llt : lanelets) {
+        if (lanelet::geometry::inside(llt, point)) {
+          expected.push_back(llt);
+        }
+      }
+      EXPECT_EQ(expected, index.contains(point));
+    }
+  }
+}
+
+TEST_F(LaneletSubsetIndexTest, Nearest)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletSubsetIndex index(lanelets);
+
+  // the far lane first, then the closest of the others
+  const auto nearest = index.nearest(lanelet::BasicPoint2d(95.0, 5.0), 2);
+  ASSERT_EQ(2U, nearest.size());
+  EXPECT_EQ(lanelets[3], nearest[0]);
+  EXPECT_EQ(lanelets[2], nearest[1]);
+
+  const auto all = index.nearest(lanelet::BasicPoint2d(-1.0, 5.0), 10);
+  ASSERT_EQ(lanelets.size(), all.size());
+  EXPECT_EQ(lanelets[0], all[0]);
+  EXPECT_EQ(lanelets[1], all[1]);
+  EXPECT_EQ(lanelets[4], all[2]);
+  EXPECT_EQ(lanelets[2], all[3]);
+  EXPECT_EQ(lanelets[3], all[4]);
+}
+
+TEST_F(LaneletSubsetIndexTest, WithinRange)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletSubsetIndex index(lanelets);
+
+  const auto found = index.withinRange(lanelet::BasicPoint2d(1.5, 11.0), 1.0);
+  ASSERT_EQ(1U, found.size());
+  EXPECT_EQ(lanelets[0], found[0]);
+
+  // the corner of the second lane is 1.8m away, the one of the third lane 4.6m
+  const auto more = index.withinRange(lanelet::BasicPoint2d(1.5, 11.0), 2.0);
+  ASSERT_EQ(3U, more.size());
+  EXPECT_EQ(lanelets[0], more[0]);
+  EXPECT_EQ(lanelets[1], more[1]);
+  EXPECT_EQ(lanelets[4], more[2]);
+
+  EXPECT_TRUE(index.withinRange(lanelet::BasicPoint2d(1.5, 5.0), -1.0).empty());
+
+  const auto distances = index.distancesWithinRange(lanelet::BasicPoint2d(1.5, 11.0), 2.0);
+  ASSERT_EQ(more.size(), distances.size());
+  for (std::size_t i = 0; i < more.size(); ++i) {
+    EXPECT_EQ(more[i], distances[i].first);
+    EXPECT_DOUBLE_EQ(
+      boost::geometry::distance(
+        more[i].polygon2d().basicPolygon(), lanelet::BasicPoint2d(1.5, 11.0)),
+      distances[i].second);
+  }
+  EXPECT_TRUE(index.distancesWithinRange(lanelet::BasicPoint2d(1.5, 5.0), -1.0).empty());
+}
+
+TEST_F(LaneletSubsetIndexTest, Intersecting)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletSubsetIndex index(lanelets);
+
+  const lanelet::BasicPolygon2d polygon{
+    lanelet::BasicPoint2d(5.0, 4.0), lanelet::BasicPoint2d(7.0, 4.0),
+    lanelet::BasicPoint2d(7.0, 6.0), lanelet::BasicPoint2d(5.0, 6.0)};
+  const auto found = index.intersecting(polygon);
+  ASSERT_EQ(3U, found.size());
+  EXPECT_EQ(lanelets[1], found[0]);
+  EXPECT_EQ(lanelets[2], found[1]);
+  EXPECT_EQ(lanelets[4], found[2]);
+}
+
+TEST_F(LaneletSubsetIndexTest, QueryOverloads)  // NOLINT for gtest
+{
+  const lanelet::utils::LaneletSubsetIndex index(lanelets);
+
+  geometry_msgs::msg::Pose search_pose;
+  search_pose.position.x = 4.5;
+  search_pose.position.y = 5.0;
+  // facing down the y axis, against the lane direction
+  search_pose.orientation.z = std::sin(-M_PI / 4.0);
+  search_pose.orientation.w = std::cos(-M_PI / 4.0);
+
+  lanelet::ConstLanelets current_lanelets;
+  ASSERT_TRUE(lanelet::utils::query::getCurrentLanelets(index, search_pose, &current_lanelets));
+  EXPECT_EQ(2U, current_lanelets.size());
+
+  // both directions of the second lane are at distance 0, the inverted one matches the yaw
+  lanelet::ConstLanelet closest_lanelet;
+  ASSERT_TRUE(lanelet::utils::query::getClosestLanelet(index, search_pose, &closest_lanelet));
+  EXPECT_EQ(lanelets[4], closest_lanelet);
+
+  // facing the lane direction, nothing within 0.1 rad is closer than the second lane
+  search_pose.orientation.z = std::sin(M_PI / 4.0);
+  search_pose.orientation.w = std::cos(M_PI / 4.0);
+  ASSERT_TRUE(lanelet::utils::query::getClosestLaneletWithConstrains(
+    index, search_pose, &closest_lanelet, 1.0, 0.1));
+  EXPECT_EQ(lanelets[1], closest_lanelet);
+
+  // facing across the lane both directions of the second lane tie, the first one is taken
+  search_pose.orientation.z = 0.0;
+  search_pose.orientation.w = 1.0;
+  lanelet::ConstLanelet closest_lanelet_linear;
+  ASSERT_TRUE(lanelet::utils::query::getClosestLaneletWithConstrains(
+    index, search_pose, &closest_lanelet, 1.0, M_PI));
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  ASSERT_TRUE(lanelet::utils::query::getClosestLaneletWithConstrains(
+    lanelets, search_pose, &closest_lanelet_linear, 1.0, M_PI));
+#pragma GCC diagnostic pop
+  EXPECT_EQ(lanelets[1], closest_lanelet);
+  EXPECT_EQ(closest_lanelet, closest_lanelet_linear);
+
+  // nothing within 1m far away, only the third lane within 42m
+  search_pose.position.x = 50.0;
+  EXPECT_FALSE(lanelet::utils::query::getClosestLaneletWithConstrains(
+    index, search_pose, &closest_lanelet, 1.0, 0.1));
+  EXPECT_EQ(
+    1U, lanelet::utils::query::getLaneletsWithinRange(index, search_pose.position, 42.0).size());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
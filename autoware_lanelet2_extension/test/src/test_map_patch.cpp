@@ -0,0 +1,294 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/map_patch.hpp"
+
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::Points3d;
+
+namespace
+{
+/// builds a map with fixed ids, so that two calls give two versions of the same map
+lanelet::LaneletMapPtr buildMap(const bool with_far_lanelet)
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+
+  const Point3d p1(1001, 0.0, 0.0, 0.0);
+  const Point3d p2(1002, 0.0, 10.0, 0.0);
+  const Point3d p3(1003, 3.0, 0.0, 0.0);
+  const Point3d p4(1004, 3.0, 10.0, 0.0);
+  const LineString3d ls_left(1011, {p1, p2});
+  const LineString3d ls_right(1012, {p3, p4});
+  Lanelet road(1021, ls_left, ls_right);
+  road.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+
+  // custom centerline, not part of the linestring layer
+  const Point3d c1(1031, 1.5, 0.0, 0.0);
+  const Point3d c2(1032, 1.5, 10.0, 0.0);
+  road.setCenterline(LineString3d(1033, {c1, c2}));
+
+  const Point3d p9(1041, 0.0, 10.0, 4.0);
+  const Point3d p10(1042, 3.0, 10.0, 4.0);
+  const LineString3d traffic_light_base(1043, Points3d{p9, p10});
+  const LineString3d stop_line(1044, Points3d{p2, p4});
+  road.addRegulatoryElement(lanelet::autoware::AutowareTrafficLight::make(
+    1045, lanelet::AttributeMap(), {traffic_light_base}, stop_line, {}));
+  map->add(road);
+
+  if (with_far_lanelet) {
+    const Point3d p5(1051, 100.0, 0.0, 0.0);
+    const Point3d p6(1052, 100.0, 10.0, 0.0);
+    const Point3d p7(1053, 103.0, 0.0, 0.0);
+    const Point3d p8(1054, 103.0, 10.0, 0.0);
+    Lanelet far(1061, LineString3d(1062, {p5, p6}), LineString3d(1063, {p7, p8}));
+    far.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+    map->add(far);
+  }
+  return map;
+}
+
+void expectSameLayers(const lanelet::LaneletMap & expected, const lanelet::LaneletMap & actual)
+{
+  EXPECT_EQ(expected.pointLayer.size(), actual.pointLayer.size());
+  EXPECT_EQ(expected.lineStringLayer.size(), actual.lineStringLayer.size());
+  EXPECT_EQ(expected.laneletLayer.size(), actual.laneletLayer.size());
+  EXPECT_EQ(expected.regulatoryElementLayer.size(), actual.regulatoryElementLayer.size());
+  for (const auto & lanelet : expected.laneletLayer) {
+    EXPECT_TRUE(actual.laneletLayer.exists(lanelet.id()));
+  }
+  EXPECT_TRUE(lanelet::utils::computeMapPatch(expected, actual).empty());
+}
+}  // namespace
+
+TEST(MapPatch, IdenticalMapsGiveEmptyPatch)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(true);
+  const auto new_map = buildMap(true);
+  EXPECT_TRUE(lanelet::utils::computeMapPatch(*old_map, *new_map).empty());
+}
+
+TEST(MapPatch, AttributeChangeIsAppliedInPlace)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(true);
+  const auto new_map = buildMap(true);
+  new_map->laneletLayer.get(1021).attributes()["speed_limit"] = "30";
+
+  const auto patch = lanelet::utils::computeMapPatch(*old_map, *new_map);
+  ASSERT_EQ(1U, patch.lanelets.size());
+  EXPECT_TRUE(patch.points.empty());
+  EXPECT_TRUE(patch.line_strings.empty());
+
+  const auto handle = old_map->laneletLayer.get(1021);
+  lanelet::utils::applyMapPatch(patch, old_map);
+  EXPECT_EQ("30", handle.attributeOr("speed_limit", std::string("none")));
+  EXPECT_EQ(1U, handle.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>().size());
+  expectSameLayers(*new_map, *old_map);
+}
+
+TEST(MapPatch, MovedPointIsReindexed)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(true);
+  const auto new_map = buildMap(true);
+  new_map->pointLayer.get(1054).y() = 50.0;
+
+  const auto patch = lanelet::utils::computeMapPatch(*old_map, *new_map);
+  ASSERT_EQ(1U, patch.points.size());
+  EXPECT_TRUE(patch.lanelets.empty());
+
+  const auto handle = old_map->laneletLayer.get(1061);
+  // computed and kept by lanelet2 before the patch
+  EXPECT_NEAR(10.0, handle.centerline().back().y(), 1e-6);
+  lanelet::utils::applyMapPatch(patch, old_map);
+  EXPECT_DOUBLE_EQ(50.0, handle.rightBound().back().y());
+  EXPECT_NEAR(30.0, handle.centerline().back().y(), 1e-6);
+
+  const lanelet::BoundingBox2d box(
+    lanelet::BasicPoint2d(101.0, 40.0), lanelet::BasicPoint2d(102.0, 45.0));
+  const auto found = old_map->laneletLayer.search(box);
+  ASSERT_EQ(1U, found.size());
+  EXPECT_EQ(1061, found.front().id());
+}
+
+TEST(MapPatch, MovedPointLeavesUnrelatedPrimitives)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(true);
+  const auto new_map = buildMap(true);
+  new_map->pointLayer.get(1054).y() = 50.0;
+  const auto patch = lanelet::utils::computeMapPatch(*old_map, *new_map);
+
+  // the road lanelet and everything it refers to is far from the moved point
+  const auto road = old_map->laneletLayer.get(1021);
+  const auto road_centerline = road.centerline();
+  const auto traffic_light = old_map->regulatoryElementLayer.get(1045);
+  const auto stop_line_point = old_map->pointLayer.get(1002);
+  lanelet::utils::applyMapPatch(patch, old_map);
+
+  // the layers are rebuilt, but from the same primitives
+  EXPECT_EQ(road.constData(), old_map->laneletLayer.get(1021).constData());
+  EXPECT_EQ(road.leftBound().constData(), old_map->lineStringLayer.get(1011).constData());
+  EXPECT_EQ(traffic_light, old_map->regulatoryElementLayer.get(1045));
+  EXPECT_EQ(stop_line_point.constData(), old_map->pointLayer.get(1002).constData());
+  EXPECT_DOUBLE_EQ(10.0, old_map->pointLayer.get(1002).y());
+  EXPECT_EQ(road_centerline.id(), old_map->laneletLayer.get(1021).centerline().id());
+  EXPECT_EQ(1U, old_map->laneletLayer.findUsages(traffic_light).size());
+
+  const lanelet::BoundingBox2d box(
+    lanelet::BasicPoint2d(1.0, 1.0), lanelet::BasicPoint2d(2.0, 2.0));
+  const auto found = old_map->laneletLayer.search(box);
+  ASSERT_EQ(1U, found.size());
+  EXPECT_EQ(1021, found.front().id());
+}
+
+TEST(MapPatch, AddAndRemoveLanelets)  // NOLINT for gtest
+{
+  const auto with_far = buildMap(true);
+  const auto without_far = buildMap(false);
+
+  auto map = buildMap(false);
+  auto patch = lanelet::utils::computeMapPatch(*without_far, *with_far);
+  EXPECT_EQ(1U, patch.lanelets.size());
+  EXPECT_TRUE(patch.removed_lanelets.empty());
+  lanelet::utils::applyMapPatch(patch, map);
+  expectSameLayers(*with_far, *map);
+
+  patch = lanelet::utils::computeMapPatch(*with_far, *without_far);
+  EXPECT_TRUE(patch.lanelets.empty());
+  ASSERT_EQ(1U, patch.removed_lanelets.size());
+  EXPECT_EQ(1061, patch.removed_lanelets.front());
+  lanelet::utils::applyMapPatch(patch, map);
+  expectSameLayers(*without_far, *map);
+}
+
+TEST(MapPatch, ChangedCenterlineAndRegulatoryElement)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(true);
+  const auto new_map = buildMap(true);
+  auto road = new_map->laneletLayer.get(1021);
+  const Point3d c1(1071, 1.0, 0.0, 0.0);
+  const Point3d c2(1072, 2.0, 10.0, 0.0);
+  road.setCenterline(LineString3d(1073, {c1, c2}));
+  const auto traffic_light = new_map->regulatoryElementLayer.get(1045);
+  traffic_light->attributes()["note"] = "moved";
+
+  const auto patch = lanelet::utils::computeMapPatch(*old_map, *new_map);
+  ASSERT_EQ(1U, patch.lanelets.size());
+  ASSERT_EQ(1U, patch.line_strings.size());
+  EXPECT_FALSE(patch.line_strings.front().in_layer);
+  EXPECT_EQ(2U, patch.points.size());
+  ASSERT_EQ(1U, patch.regulatory_elements.size());
+
+  lanelet::utils::applyMapPatch(patch, old_map);
+  const auto patched = old_map->laneletLayer.get(1021);
+  ASSERT_TRUE(patched.hasCustomCenterline());
+  EXPECT_EQ(1073, patched.centerline().id());
+  EXPECT_FALSE(old_map->lineStringLayer.exists(1073));
+  EXPECT_EQ(
+    "moved", old_map->regulatoryElementLayer.get(1045)->attributeOr("note", std::string("none")));
+  expectSameLayers(*new_map, *old_map);
+}
+
+TEST(MapPatch, RejectedPatchLeavesMapUntouched)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(true);
+  const auto new_map = buildMap(true);
+  new_map->laneletLayer.get(1021).attributes()["speed_limit"] = "30";
+  new_map->pointLayer.get(1054).y() = 50.0;
+  const auto patch = lanelet::utils::computeMapPatch(*old_map, *new_map);
+  const auto old_fingerprint = lanelet::utils::conversion::computeFingerprint(*old_map);
+  EXPECT_EQ(old_fingerprint, patch.base_fingerprint);
+  EXPECT_EQ(lanelet::utils::conversion::computeFingerprint(*new_map), patch.fingerprint);
+
+  // computed against another version of the map
+  const auto other_map = buildMap(false);
+  EXPECT_THROW(
+    lanelet::utils::applyMapPatch(
+      patch, other_map, lanelet::utils::conversion::computeFingerprint(*other_map)),
+    std::runtime_error);
+  expectSameLayers(*buildMap(false), *other_map);
+
+  // refers to a linestring the map does not have, the point is patched before the lanelets
+  ASSERT_EQ(1U, patch.lanelets.size());
+  auto broken = patch;
+  broken.lanelets.front().left.id = 9999;
+  EXPECT_THROW(
+    lanelet::utils::applyMapPatch(broken, old_map, old_fingerprint), std::runtime_error);
+  expectSameLayers(*buildMap(true), *old_map);
+  EXPECT_DOUBLE_EQ(10.0, old_map->pointLayer.get(1054).y());
+
+  lanelet::utils::applyMapPatch(patch, old_map, old_fingerprint);
+  expectSameLayers(*new_map, *old_map);
+
+  // the fingerprint of the patched map is taken from the patch, not computed again
+  auto next_map = buildMap(true);
+  next_map->laneletLayer.get(1021).attributes()["speed_limit"] = "40";
+  next_map->pointLayer.get(1054).y() = 50.0;
+  const auto next_patch = lanelet::utils::computeMapPatch(*new_map, *next_map);
+  EXPECT_EQ(patch.fingerprint, next_patch.base_fingerprint);
+  lanelet::utils::applyMapPatch(next_patch, old_map, patch.fingerprint);
+  expectSameLayers(*next_map, *old_map);
+}
+
+TEST(MapPatch, MessageRoundTrip)  // NOLINT for gtest
+{
+  const auto old_map = buildMap(false);
+  const auto new_map = buildMap(true);
+  new_map->laneletLayer.get(1021).attributes()["speed_limit"] = "30";
+
+  const auto patch = lanelet::utils::computeMapPatch(*old_map, *new_map);
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toPatchMsg(
+    patch, &msg, lanelet::utils::conversion::BinMsgCompression::Zstd);
+  ASSERT_TRUE(lanelet::utils::conversion::isPatchMsg(msg));
+  lanelet::utils::MapPatch decoded;
+  lanelet::utils::conversion::fromPatchMsg(msg, &decoded);
+  EXPECT_EQ(patch.base_fingerprint, decoded.base_fingerprint);
+  EXPECT_EQ(patch.fingerprint, decoded.fingerprint);
+
+  lanelet::utils::conversion::applyPatchMsg(
+    msg, old_map, lanelet::utils::conversion::computeFingerprint(*old_map));
+  expectSameLayers(*new_map, *old_map);
+  EXPECT_EQ("30", old_map->laneletLayer.get(1021).attributeOr("speed_limit", std::string("none")));
+
+  // a patch is not a map
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  EXPECT_ANY_THROW(
+    lanelet::utils::conversion::fromBinMsg(msg, map, lanelet::utils::conversion::BinMsgLayer::All));
+
+  autoware_map_msgs::msg::LaneletMapBin map_msg;
+  lanelet::utils::conversion::toBinMsg(
+    new_map, &map_msg, lanelet::utils::conversion::BinMsgCompression::LZ4);
+  EXPECT_FALSE(lanelet::utils::conversion::isPatchMsg(map_msg));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,629 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "../../lib/bin_msg_codec.hpp"
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+#include "autoware_lanelet2_extension/traffic_rules/autoware_traffic_rules.hpp"
+#include "autoware_lanelet2_extension/utility/message_conversion.hpp"
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingCost.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::Points3d;
+using lanelet::utils::getId;
+using lanelet::utils::conversion::BinMsgCompression;
+
+class TestSuite : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  TestSuite() : sample_map_ptr(new lanelet::LaneletMap())
+  {
+    // create sample lanelets
+    const Point3d p1(getId(), 0.0, 0.0, 0.0);
+    const Point3d p2(getId(), 0.0, 10.0, 0.0);
+    const Point3d p3(getId(), 3.0, 0.0, 0.0);
+    const Point3d p4(getId(), 3.0, 10.0, 0.0);
+    const Point3d p5(getId(), 0.0, 20.0, 0.0);
+    const Point3d p6(getId(), 3.0, 20.0, 0.0);
+
+    const LineString3d ls_left(getId(), {p1, p2});
+    const LineString3d ls_right(getId(), {p3, p4});
+    const LineString3d ls_left2(getId(), {p2, p5});
+    const LineString3d ls_right2(getId(), {p4, p6});
+
+    Lanelet road_lanelet(getId(), ls_left, ls_right);
+    road_lanelet.attributes()[lanelet::AttributeName::Subtype] =
+      lanelet::AttributeValueString::Road;
+    Lanelet next_lanelet(getId(), ls_left2, ls_right2);
+    next_lanelet.attributes()[lanelet::AttributeName::Subtype] =
+      lanelet::AttributeValueString::Road;
+
+    // create sample traffic light
+    const Point3d p7(getId(), 0.0, 10.0, 4.0);
+    const Point3d p8(getId(), 3.0, 10.0, 4.0);
+    const Point3d p9(getId(), 1.0, 10.0, 4.5);
+    const Point3d p10(getId(), 2.0, 10.0, 4.5);
+    const LineString3d traffic_light_base(getId(), Points3d{p7, p8});
+    LineString3d traffic_light_bulbs(getId(), Points3d{p9, p10});
+    traffic_light_bulbs.attributes()["traffic_light_id"] = traffic_light_base.id();
+    const LineString3d stop_line(getId(), Points3d{p2, p4});
+
+    auto tl = lanelet::autoware::AutowareTrafficLight::make(
+      getId(), lanelet::AttributeMap(), {traffic_light_base}, stop_line, {traffic_light_bulbs});
+    road_lanelet.addRegulatoryElement(tl);
+
+    // create sample landmark
+    lanelet::Polygon3d landmark(getId(), {p1, p3, p4, p2});
+    landmark.attributes()[lanelet::AttributeName::Type] = "pose_marker";
+    landmark.attributes()[lanelet::AttributeName::Subtype] = "apriltag_16h5";
+
+    sample_map_ptr->add(road_lanelet);
+    sample_map_ptr->add(next_lanelet);
+    sample_map_ptr->add(landmark);
+  }
+
+  ~TestSuite() override = default;
+
+  lanelet::LaneletMapPtr sample_map_ptr;
+
+private:
+};
+
+void expectSameMap(const lanelet::LaneletMap & expected, const lanelet::LaneletMap & actual)
+{
+  EXPECT_EQ(expected.pointLayer.size(), actual.pointLayer.size());
+  EXPECT_EQ(expected.lineStringLayer.size(), actual.lineStringLayer.size());
+  EXPECT_EQ(expected.polygonLayer.size(), actual.polygonLayer.size());
+  EXPECT_EQ(expected.laneletLayer.size(), actual.laneletLayer.size());
+  EXPECT_EQ(expected.areaLayer.size(), actual.areaLayer.size());
+  EXPECT_EQ(expected.regulatoryElementLayer.size(), actual.regulatoryElementLayer.size());
+
+  for (const auto & point : expected.pointLayer) {
+    ASSERT_TRUE(actual.pointLayer.exists(point.id()));
+    const auto actual_point = actual.pointLayer.get(point.id());
+    EXPECT_DOUBLE_EQ(point.x(), actual_point.x());
+    EXPECT_DOUBLE_EQ(point.y(), actual_point.y());
+    EXPECT_DOUBLE_EQ(point.z(), actual_point.z());
+  }
+  for (const auto & lanelet : expected.laneletLayer) {
+    ASSERT_TRUE(actual.laneletLayer.exists(lanelet.id()));
+    const auto actual_lanelet = actual.laneletLayer.get(lanelet.id());
+    EXPECT_EQ(lanelet.leftBound().id(), actual_lanelet.leftBound().id());
+    EXPECT_EQ(lanelet.rightBound().id(), actual_lanelet.rightBound().id());
+    EXPECT_EQ(lanelet.regulatoryElements().size(), actual_lanelet.regulatoryElements().size());
+    EXPECT_EQ(
+      lanelet.attributeOr(lanelet::AttributeName::Subtype, "none"),
+      actual_lanelet.attributeOr(lanelet::AttributeName::Subtype, "none"));
+  }
+}
+
+TEST_F(TestSuite, LegacyPayloadHasNoHeader)  // NOLINT for gtest
+{
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(
+    sample_map_ptr, &msg, lanelet::utils::conversion::BinMsgFormat::Legacy);
+  ASSERT_FALSE(msg.data.empty());
+  EXPECT_FALSE(
+    lanelet::utils::conversion::impl::hasBinMsgHeader(msg.data.data(), msg.data.size()));
+
+  lanelet::LaneletMap decoded;
+  lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded);
+  expectSameMap(*sample_map_ptr, decoded);
+
+  EXPECT_THROW(
+    lanelet::utils::conversion::toBinMsg(
+      sample_map_ptr, &msg, lanelet::utils::conversion::BinMsgFormat::Legacy,
+      BinMsgCompression::LZ4),
+    std::invalid_argument);
+}
+
+TEST_F(TestSuite, UncompressedPayloadHasHeader)  // NOLINT for gtest
+{
+  // the default encoding carries the fingerprint, so that subscribers can skip decoding
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, BinMsgCompression::None);
+  ASSERT_TRUE(
+    lanelet::utils::conversion::impl::hasBinMsgHeader(msg.data.data(), msg.data.size()));
+  EXPECT_EQ(
+    BinMsgCompression::None,
+    lanelet::utils::conversion::impl::readBinMsgHeader(msg.data.data(), msg.data.size())
+      .compression);
+
+  const auto peeked = lanelet::utils::conversion::peekFingerprint(msg);
+  ASSERT_TRUE(peeked.has_value());
+  EXPECT_EQ(lanelet::utils::conversion::computeFingerprint(*sample_map_ptr), *peeked);
+
+  lanelet::LaneletMapPtr decoded = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(msg, decoded);
+  expectSameMap(*sample_map_ptr, *decoded);
+}
+
+TEST_F(TestSuite, CompressedPayloadRoundTrip)  // NOLINT for gtest
+{
+  for (const auto compression : {BinMsgCompression::LZ4, BinMsgCompression::Zstd}) {
+    autoware_map_msgs::msg::LaneletMapBin msg;
+    lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, compression);
+    ASSERT_TRUE(
+      lanelet::utils::conversion::impl::hasBinMsgHeader(msg.data.data(), msg.data.size()));
+
+    const auto header =
+      lanelet::utils::conversion::impl::readBinMsgHeader(msg.data.data(), msg.data.size());
+    EXPECT_EQ(compression, header.compression);
+
+    lanelet::LaneletMap decoded;
+    const auto id_counter = lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded);
+    EXPECT_GT(id_counter, 0);
+    expectSameMap(*sample_map_ptr, decoded);
+  }
+}
+
+TEST_F(TestSuite, FlatPayloadRoundTrip)  // NOLINT for gtest
+{
+  for (const auto compression : {BinMsgCompression::None, BinMsgCompression::Zstd}) {
+    autoware_map_msgs::msg::LaneletMapBin msg;
+    lanelet::utils::conversion::toBinMsg(
+      sample_map_ptr, &msg, lanelet::utils::conversion::BinMsgFormat::Flat, compression);
+
+    lanelet::LaneletMapPtr decoded = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(
+      msg, decoded, lanelet::utils::conversion::BinMsgLayer::All);
+    expectSameMap(*sample_map_ptr, *decoded);
+  }
+}
+
+TEST_F(TestSuite, FlatPayloadLayerMask)  // NOLINT for gtest
+{
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(
+    sample_map_ptr, &msg, lanelet::utils::conversion::BinMsgFormat::Flat);
+
+  lanelet::LaneletMapPtr decoded = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(
+    msg, decoded, lanelet::utils::conversion::BinMsgLayer::Polygons);
+  EXPECT_EQ(sample_map_ptr->polygonLayer.size(), decoded->polygonLayer.size());
+  EXPECT_TRUE(decoded->laneletLayer.empty());
+  EXPECT_TRUE(decoded->lineStringLayer.empty());
+  EXPECT_TRUE(decoded->regulatoryElementLayer.empty());
+
+  // lanelets keep their bounds even if the linestring layer is not requested
+  lanelet::utils::conversion::fromBinMsg(
+    msg, decoded, lanelet::utils::conversion::BinMsgLayer::Lanelets);
+  ASSERT_EQ(sample_map_ptr->laneletLayer.size(), decoded->laneletLayer.size());
+  for (const auto & lanelet : decoded->laneletLayer) {
+    EXPECT_FALSE(lanelet.leftBound().empty());
+  }
+  EXPECT_TRUE(decoded->lineStringLayer.empty());
+}
+
+TEST_F(TestSuite, FingerprintIsStoredInHeader)  // NOLINT for gtest
+{
+  const auto fingerprint = lanelet::utils::conversion::computeFingerprint(*sample_map_ptr);
+
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, BinMsgCompression::LZ4);
+  const auto peeked = lanelet::utils::conversion::peekFingerprint(msg);
+  ASSERT_TRUE(peeked.has_value());
+  EXPECT_EQ(fingerprint, *peeked);
+
+  // the decoded map has another layer order but the same content
+  lanelet::LaneletMap decoded;
+  lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded);
+  EXPECT_EQ(fingerprint, lanelet::utils::conversion::computeFingerprint(decoded));
+
+  autoware_map_msgs::msg::LaneletMapBin legacy_msg;
+  lanelet::utils::conversion::toBinMsg(
+    sample_map_ptr, &legacy_msg, lanelet::utils::conversion::BinMsgFormat::Legacy);
+  EXPECT_FALSE(lanelet::utils::conversion::peekFingerprint(legacy_msg).has_value());
+
+  auto point = *sample_map_ptr->pointLayer.begin();
+  point.x() += 0.01;
+  EXPECT_NE(fingerprint, lanelet::utils::conversion::computeFingerprint(*sample_map_ptr));
+  point.x() -= 0.01;
+  auto lanelet = *sample_map_ptr->laneletLayer.begin();
+  lanelet.attributes()["speed_limit"] = "30";
+  EXPECT_NE(fingerprint, lanelet::utils::conversion::computeFingerprint(*sample_map_ptr));
+}
+
+TEST_F(TestSuite, VersionOneHeaderIsReadable)  // NOLINT for gtest
+{
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, BinMsgCompression::Zstd);
+
+  // drop the fingerprint field like an encoder of the first header version
+  auto & data = msg.data;
+  data.erase(
+    data.begin() + lanelet::utils::conversion::impl::bin_msg_header_v1_size,
+    data.begin() + lanelet::utils::conversion::impl::bin_msg_header_size);
+  data[4] = 1;
+  EXPECT_FALSE(lanelet::utils::conversion::peekFingerprint(msg).has_value());
+
+  lanelet::LaneletMap decoded;
+  lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded);
+  expectSameMap(*sample_map_ptr, decoded);
+}
+
+TEST_F(TestSuite, SharedMapIsDecodedOnce)  // NOLINT for gtest
+{
+  lanelet::utils::conversion::clearBinMsgCache();
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, BinMsgCompression::LZ4);
+
+  const auto first = lanelet::utils::conversion::fromBinMsgShared(msg);
+  const auto second = lanelet::utils::conversion::fromBinMsgShared(msg);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first, second);
+  expectSameMap(*sample_map_ptr, *first);
+
+  lanelet::utils::conversion::clearBinMsgCache();
+  const auto third = lanelet::utils::conversion::fromBinMsgShared(msg);
+  EXPECT_NE(first, third);
+
+  // legacy payloads have no fingerprint and are recognized by their bytes
+  autoware_map_msgs::msg::LaneletMapBin legacy_msg;
+  lanelet::utils::conversion::toBinMsg(
+    sample_map_ptr, &legacy_msg, lanelet::utils::conversion::BinMsgFormat::Legacy);
+  const auto legacy_first = lanelet::utils::conversion::fromBinMsgShared(legacy_msg);
+  const auto legacy_second = lanelet::utils::conversion::fromBinMsgShared(legacy_msg);
+  ASSERT_TRUE(legacy_first);
+  EXPECT_NE(third, legacy_first);
+  EXPECT_EQ(legacy_first, legacy_second);
+  expectSameMap(*sample_map_ptr, *legacy_first);
+  lanelet::utils::conversion::clearBinMsgCache();
+}
+
+TEST_F(TestSuite, CorruptedPayloadThrows)  // NOLINT for gtest
+{
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, BinMsgCompression::LZ4);
+  msg.data.resize(msg.data.size() / 2);
+
+  lanelet::LaneletMap decoded;
+  EXPECT_ANY_THROW(lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded));
+}
+
+TEST_F(TestSuite, ImplausibleDecodedSizeThrows)  // NOLINT for gtest
+{
+  for (const auto compression : {BinMsgCompression::LZ4, BinMsgCompression::Zstd}) {
+    autoware_map_msgs::msg::LaneletMapBin msg;
+    lanelet::utils::conversion::toBinMsg(sample_map_ptr, &msg, compression);
+    auto header =
+      lanelet::utils::conversion::impl::readBinMsgHeader(msg.data.data(), msg.data.size());
+    header.raw_size = 1ULL << 40U;
+    lanelet::utils::conversion::impl::writeBinMsgHeader(header, msg.data.data());
+
+    lanelet::LaneletMap decoded;
+    EXPECT_THROW(
+      lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded), std::runtime_error);
+  }
+}
+
+namespace
+{
+/// two lanes of two lanelets each, with a dashed line in between, and a lanelet crossing both lanes
+lanelet::LaneletMapPtr buildRoutingMap()
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  const auto line = [](const lanelet::Points3d & points, const char * subtype) {
+    LineString3d line_string(getId(), points);
+    line_string.attributes()[lanelet::AttributeName::Type] = "line_thin";
+    line_string.attributes()[lanelet::AttributeName::Subtype] = subtype;
+    return line_string;
+  };
+  const auto road = [](const LineString3d & left, const LineString3d & right) {
+    Lanelet lanelet(getId(), left, right);
+    lanelet.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+    return lanelet;
+  };
+
+  std::vector<Points3d> columns;
+  for (const double x : {0.0, 3.0, 6.0}) {
+    columns.push_back(
+      {Point3d(getId(), x, 0.0, 0.0), Point3d(getId(), x, 10.0, 0.0),
+       Point3d(getId(), x, 20.0, 0.0)});
+  }
+  for (std::size_t segment = 0; segment < 2; ++segment) {
+    const auto bound = [&](const std::size_t column, const char * subtype) {
+      return line({columns[column][segment], columns[column][segment + 1]}, subtype);
+    };
+    const auto left = bound(0, "solid");
+    const auto middle = bound(1, "dashed");
+    const auto right = bound(2, "solid");
+    map->add(road(left, middle));
+    map->add(road(middle, right));
+  }
+  map->add(road(
+    line({Point3d(getId(), -5.0, 6.0, 0.0), Point3d(getId(), 10.0, 6.0, 0.0)}, "solid"),
+    line({Point3d(getId(), -5.0, 4.0, 0.0), Point3d(getId(), 10.0, 4.0, 0.0)}, "solid")));
+  return map;
+}
+
+std::set<lanelet::Id> ids(const lanelet::ConstLanelets & lanelets)
+{
+  std::set<lanelet::Id> result;
+  for (const auto & lanelet : lanelets) {
+    result.insert(lanelet.id());
+  }
+  return result;
+}
+
+std::set<lanelet::Id> ids(const lanelet::ConstLaneletOrAreas & primitives)
+{
+  std::set<lanelet::Id> result;
+  for (const auto & primitive : primitives) {
+    result.insert(primitive.id());
+  }
+  return result;
+}
+
+void expectSameGraph(
+  const lanelet::LaneletMap & expected_map, const lanelet::routing::RoutingGraph & expected,
+  const lanelet::LaneletMap & actual_map, const lanelet::routing::RoutingGraph & actual,
+  const std::size_t routing_cost_count = 1)
+{
+  for (const auto & expected_lanelet : expected_map.laneletLayer) {
+    const auto actual_lanelet = actual_map.laneletLayer.get(expected_lanelet.id());
+    EXPECT_EQ(ids(expected.following(expected_lanelet)), ids(actual.following(actual_lanelet)));
+    EXPECT_EQ(ids(expected.besides(expected_lanelet)), ids(actual.besides(actual_lanelet)));
+    EXPECT_EQ(
+      ids(expected.conflicting(expected_lanelet)), ids(actual.conflicting(actual_lanelet)));
+
+    const auto expected_relations = expected.followingRelations(expected_lanelet, true);
+    ASSERT_EQ(expected_relations.size(), actual.followingRelations(actual_lanelet, true).size());
+    for (const auto & relation : expected_relations) {
+      const auto expected_cost = expected.getEdgeCost(expected_lanelet, relation.lanelet);
+      const auto actual_cost = actual.getEdgeCost(
+        actual_lanelet, actual_map.laneletLayer.get(relation.lanelet.id()));
+      ASSERT_TRUE(expected_cost && actual_cost);
+      EXPECT_DOUBLE_EQ(*expected_cost, *actual_cost);
+    }
+
+    // only routing cost id 0 can be read edge by edge, the others are told apart by their reach
+    for (std::size_t cost_id = 0; cost_id < routing_cost_count; ++cost_id) {
+      const auto id = static_cast<lanelet::routing::RoutingCostId>(cost_id);
+      for (const double max_cost : {1.0, 5.0, 12.0, 25.0, 1000.0}) {
+        EXPECT_EQ(
+          ids(expected.reachableSet(expected_lanelet, max_cost, id)),
+          ids(actual.reachableSet(actual_lanelet, max_cost, id)));
+      }
+    }
+  }
+}
+
+lanelet::utils::conversion::impl::RoutingGraphSection withoutConflicts(
+  lanelet::utils::conversion::impl::RoutingGraphSection section)
+{
+  auto & edges = section.edges;
+  edges.erase(
+    std::remove_if(
+      edges.begin(), edges.end(),
+      [](const lanelet::utils::conversion::impl::RoutingGraphSection::Edge & edge) {
+        return static_cast<lanelet::routing::RelationType>(edge.relation) ==
+               lanelet::routing::RelationType::Conflicting;
+      }),
+    edges.end());
+  return section;
+}
+
+std::size_t countConflicts(
+  const lanelet::LaneletMap & map, const lanelet::routing::RoutingGraph & graph)
+{
+  std::size_t count = 0;
+  for (const auto & lanelet : map.laneletLayer) {
+    count += graph.conflicting(lanelet).size();
+  }
+  return count;
+}
+}  // namespace
+
+TEST(EmbeddedRoutingGraph, IsRestored)  // NOLINT for gtest
+{
+  const auto map = buildRoutingMap();
+  const lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
+    lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+  const lanelet::routing::RoutingCostPtrs routing_costs{
+    lanelet::routing::defaultRoutingCosts().front()};
+  const lanelet::routing::RoutingGraphConstPtr routing_graph =
+    lanelet::routing::RoutingGraph::build(*map, *traffic_rules, routing_costs);
+  ASSERT_LT(0U, countConflicts(*map, *routing_graph));
+
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(
+    map, routing_graph, *traffic_rules, &msg, BinMsgCompression::LZ4);
+  const auto header =
+    lanelet::utils::conversion::impl::readBinMsgHeader(msg.data.data(), msg.data.size());
+  EXPECT_NE(0, header.flags & lanelet::utils::conversion::impl::BinMsgFlag::RoutingGraph);
+
+  std::optional<lanelet::utils::conversion::impl::RoutingGraphSection> section;
+  lanelet::LaneletMap decoded_map;
+  lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded_map, &section);
+  ASSERT_TRUE(section.has_value());
+  EXPECT_EQ(
+    section->fingerprint,
+    lanelet::utils::conversion::impl::makeRoutingGraphFingerprint(decoded_map, *traffic_rules));
+
+  // restored without building
+  const auto restored = lanelet::utils::conversion::impl::restoreRoutingGraph(
+    decoded_map, *traffic_rules, routing_costs, *section);
+  expectSameGraph(*map, *routing_graph, decoded_map, *restored);
+
+  // the graph is taken from the section, not built: relations dropped from it stay missing
+  const auto tampered = withoutConflicts(*section);
+  const auto restored_tampered = lanelet::utils::conversion::impl::restoreOrBuildRoutingGraph(
+    decoded_map, *traffic_rules, routing_costs, tampered);
+  EXPECT_EQ(0U, countConflicts(decoded_map, *restored_tampered));
+
+  lanelet::LaneletMapPtr decoded_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  lanelet::routing::RoutingGraphPtr decoded_graph;
+  lanelet::utils::conversion::fromBinMsg(
+    msg, decoded_map_ptr, traffic_rules, routing_costs, &decoded_graph);
+  ASSERT_TRUE(decoded_graph);
+  expectSameMap(*map, *decoded_map_ptr);
+  expectSameGraph(*map, *routing_graph, *decoded_map_ptr, *decoded_graph);
+}
+
+TEST(EmbeddedRoutingGraph, IsRestoredWithDefaultRoutingCosts)  // NOLINT for gtest
+{
+  const auto map = buildRoutingMap();
+  const auto default_costs = lanelet::routing::defaultRoutingCosts();
+  ASSERT_LT(1U, default_costs.size());
+
+  // both the overload with the default routing costs and the deprecated one, which uses the
+  // traffic rules of Germany
+  for (const bool deprecated_overload : {false, true}) {
+    const lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
+      lanelet::traffic_rules::TrafficRulesFactory::create(
+        deprecated_overload ? lanelet::Locations::Germany : lanelet::autoware::DefaultLocation,
+        lanelet::Participants::Vehicle);
+    const lanelet::routing::RoutingGraphConstPtr routing_graph =
+      lanelet::routing::RoutingGraph::build(*map, *traffic_rules, default_costs);
+
+    autoware_map_msgs::msg::LaneletMapBin msg;
+    lanelet::utils::conversion::toBinMsg(
+      map, routing_graph, *traffic_rules, &msg, BinMsgCompression::LZ4);
+    std::optional<lanelet::utils::conversion::impl::RoutingGraphSection> section;
+    lanelet::LaneletMap decoded_map;
+    lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded_map, &section);
+    ASSERT_TRUE(section.has_value());
+
+    // every routing cost is restored, not only the embedded one
+    const auto restored = lanelet::utils::conversion::impl::restoreRoutingGraph(
+      decoded_map, *traffic_rules, default_costs, *section);
+    expectSameGraph(*map, *routing_graph, decoded_map, *restored, default_costs.size());
+
+    // republished without conflicting edges, so that a restored graph is told apart
+    autoware_map_msgs::msg::LaneletMapBin tampered_msg;
+    const auto tampered = withoutConflicts(*section);
+    lanelet::utils::conversion::impl::writeMapPayload(
+      decoded_map, BinMsgCompression::LZ4, &tampered_msg.data, &tampered);
+
+    auto decoded_map_ptr = std::make_shared<lanelet::LaneletMap>();
+    lanelet::routing::RoutingGraphPtr decoded_graph;
+    if (!deprecated_overload) {
+      lanelet::utils::conversion::fromBinMsg(
+        tampered_msg, decoded_map_ptr, traffic_rules, &decoded_graph);
+    } else {
+      lanelet::traffic_rules::TrafficRulesPtr deprecated_rules;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+      lanelet::utils::conversion::fromBinMsg(
+        tampered_msg, decoded_map_ptr, &deprecated_rules, &decoded_graph);
+#pragma GCC diagnostic pop
+    }
+    ASSERT_TRUE(decoded_graph);
+    EXPECT_EQ(0U, countConflicts(*decoded_map_ptr, *decoded_graph));
+
+    // and the untouched payload gives the graph the publisher built
+    decoded_map_ptr = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(msg, decoded_map_ptr, traffic_rules, &decoded_graph);
+    ASSERT_TRUE(decoded_graph);
+    expectSameGraph(
+      *map, *routing_graph, *decoded_map_ptr, *decoded_graph, default_costs.size());
+  }
+}
+
+TEST(EmbeddedRoutingGraph, IsRebuiltOnMismatch)  // NOLINT for gtest
+{
+  const auto map = buildRoutingMap();
+  const lanelet::traffic_rules::TrafficRulesPtr traffic_rules =
+    lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+  const lanelet::routing::RoutingCostPtrs routing_costs{
+    lanelet::routing::defaultRoutingCosts().front()};
+  const lanelet::routing::RoutingGraphConstPtr routing_graph =
+    lanelet::routing::RoutingGraph::build(*map, *traffic_rules, routing_costs);
+
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(map, routing_graph, *traffic_rules, &msg);
+
+  std::optional<lanelet::utils::conversion::impl::RoutingGraphSection> section;
+  lanelet::LaneletMap decoded_map;
+  lanelet::utils::conversion::impl::readMapPayload(msg.data, &decoded_map, &section);
+  ASSERT_TRUE(section.has_value());
+
+  // without conflicting edges, a restored graph would be told apart from a built one
+  const auto tampered = withoutConflicts(*section);
+
+  // other traffic rules
+  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
+  const auto pedestrian_fingerprint =
+    lanelet::utils::conversion::impl::makeRoutingGraphFingerprint(decoded_map, *pedestrian_rules);
+  EXPECT_NE(section->fingerprint, pedestrian_fingerprint);
+
+  // another first routing cost than the embedded one
+  const auto default_costs = lanelet::routing::defaultRoutingCosts();
+  ASSERT_LT(1U, default_costs.size());
+  const auto other_first_cost = lanelet::utils::conversion::impl::restoreOrBuildRoutingGraph(
+    decoded_map, *traffic_rules, {default_costs[1], default_costs[0]}, tampered);
+  EXPECT_LT(0U, countConflicts(decoded_map, *other_first_cost));
+
+  // another map
+  auto changed = tampered;
+  changed.fingerprint.map_fingerprint += 1;
+  const auto other_map = lanelet::utils::conversion::impl::restoreOrBuildRoutingGraph(
+    decoded_map, *traffic_rules, routing_costs, changed);
+  EXPECT_LT(0U, countConflicts(decoded_map, *other_map));
+
+  // the map fingerprint of the payload header is trusted instead of hashing the map again
+  const auto header_fingerprint = lanelet::utils::conversion::peekFingerprint(msg);
+  ASSERT_TRUE(header_fingerprint.has_value());
+  EXPECT_EQ(section->fingerprint.map_fingerprint, *header_fingerprint);
+  const auto trusted = lanelet::utils::conversion::impl::restoreOrBuildRoutingGraph(
+    decoded_map, *traffic_rules, routing_costs, changed, *header_fingerprint + 1);
+  EXPECT_EQ(0U, countConflicts(decoded_map, *trusted));
+
+  // same fingerprint but other costs, found while restoring
+  changed = tampered;
+  for (auto & edge : changed.edges) {
+    if (
+      static_cast<lanelet::routing::RelationType>(edge.relation) ==
+      lanelet::routing::RelationType::Successor) {
+      edge.routing_cost *= 2.0;
+    }
+  }
+  EXPECT_THROW(
+    lanelet::utils::conversion::impl::restoreRoutingGraph(
+      decoded_map, *traffic_rules, routing_costs, changed),
+    std::runtime_error);
+  const auto other_costs = lanelet::utils::conversion::impl::restoreOrBuildRoutingGraph(
+    decoded_map, *traffic_rules, routing_costs, changed);
+  EXPECT_LT(0U, countConflicts(decoded_map, *other_costs));
+  expectSameGraph(*map, *routing_graph, decoded_map, *other_costs);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,167 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/primitive_type_index.hpp"
+
+#include "autoware_lanelet2_extension/utility/query.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <string>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::Polygon3d;
+using lanelet::utils::getId;
+
+class PrimitiveTypeIndexTest : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  PrimitiveTypeIndexTest() : sample_map_ptr(new lanelet::LaneletMap())
+  {
+    addLineString("curbstone", "high", 2);
+    addLineString("curbstone", "low", 2);
+    addLineString("fence", "", 2);
+    addLineString("wall", "", 2);
+    addLineString("guard_rail", "", 2);
+    addLineString("fence", "", 3);
+    addLineString("pedestrian_marking", "", 2);
+    addLineString("pedestrian_marking", "", 4);
+    addLineString("parking_space", "", 2);
+    addLineString("", "", 2);
+    addPolygon("parking_lot", "");
+    addPolygon("obstacle", "");
+    addPolygon("intersection_area", "");
+
+    const LineString3d left(getId(), {Point3d(getId(), 0., 0., 0.), Point3d(getId(), 0., 1., 0.)});
+    const LineString3d right(getId(), {Point3d(getId(), 1., 0., 0.), Point3d(getId(), 1., 1., 0.)});
+    Lanelet lanelet_with_waypoints(getId(), left, right);
+    const auto waypoints = addLineString("waypoints", "", 2);
+    lanelet_with_waypoints.attributes()["waypoints"] = waypoints.id();
+    sample_map_ptr->add(lanelet_with_waypoints);
+  }
+
+  ~PrimitiveTypeIndexTest() override = default;
+
+  LineString3d addLineString(const std::string & type, const std::string & subtype, int size)
+  {
+    LineString3d line_string(getId());
+    for (int i = 0; i < size; ++i) {
+      line_string.push_back(Point3d(getId(), i, size, 0.));
+    }
+    setTypes(&line_string, type, subtype);
+    sample_map_ptr->add(line_string);
+    return line_string;
+  }
+
+  void addPolygon(const std::string & type, const std::string & subtype)
+  {
+    Polygon3d polygon(
+      getId(), {Point3d(getId(), 0., 0., 0.), Point3d(getId(), 1., 0., 0.),
+                Point3d(getId(), 1., 1., 0.)});
+    setTypes(&polygon, type, subtype);
+    sample_map_ptr->add(polygon);
+  }
+
+  template <typename PrimitiveT>
+  static void setTypes(
+    PrimitiveT * primitive, const std::string & type, const std::string & subtype)
+  {
+    if (!type.empty()) {
+      primitive->attributes()[lanelet::AttributeName::Type] = type;
+    }
+    if (!subtype.empty()) {
+      primitive->attributes()[lanelet::AttributeName::Subtype] = subtype;
+    }
+  }
+
+  lanelet::LaneletMapPtr sample_map_ptr;
+};
+
+TEST_F(PrimitiveTypeIndexTest, EmptyIndex)  // NOLINT for gtest
+{
+  const lanelet::utils::PrimitiveTypeIndex index;
+  EXPECT_TRUE(index.lineStrings("curbstone").empty());
+  EXPECT_TRUE(index.polygons("parking_lot", "none").empty());
+  EXPECT_TRUE(index.waypoints().empty());
+}
+
+TEST_F(PrimitiveTypeIndexTest, TypeAndSubtype)  // NOLINT for gtest
+{
+  const lanelet::utils::PrimitiveTypeIndex index(sample_map_ptr);
+
+  EXPECT_EQ(2U, index.lineStrings("curbstone").size());
+  EXPECT_EQ(1U, index.lineStrings("curbstone", "high").size());
+  EXPECT_EQ(1U, index.lineStrings("curbstone", "low").size());
+  EXPECT_TRUE(index.lineStrings("curbstone", "none").empty());
+  EXPECT_EQ(2U, index.lineStrings("pedestrian_marking", "none").size());
+  // the untyped linestring and the bounds of the lanelet
+  EXPECT_EQ(3U, index.lineStrings("none").size());
+  EXPECT_TRUE(index.lineStrings("road_border").empty());
+
+  EXPECT_EQ(1U, index.polygons("obstacle").size());
+  EXPECT_TRUE(index.polygons("obstacle", "high").empty());
+}
+
+TEST_F(PrimitiveTypeIndexTest, QueryOverloads)  // NOLINT for gtest
+{
+  namespace query = lanelet::utils::query;
+  const lanelet::utils::PrimitiveTypeIndex index(sample_map_ptr);
+
+  EXPECT_EQ(query::curbstones(sample_map_ptr), query::curbstones(index));
+  EXPECT_EQ(query::getAllObstaclePolygons(sample_map_ptr), query::getAllObstaclePolygons(index));
+  EXPECT_EQ(query::getAllParkingLots(sample_map_ptr), query::getAllParkingLots(index));
+  EXPECT_EQ(
+    query::getAllLinestringsWithType(sample_map_ptr, "wall"),
+    query::getAllLinestringsWithType(index, "wall"));
+  EXPECT_EQ(query::getAllPartitions(sample_map_ptr), query::getAllPartitions(index));
+  EXPECT_EQ(query::getAllFences(sample_map_ptr), query::getAllFences(index));
+  EXPECT_EQ(
+    query::getAllPedestrianPolygonMarkings(sample_map_ptr),
+    query::getAllPedestrianPolygonMarkings(index));
+  EXPECT_EQ(
+    query::getAllPedestrianLineMarkings(sample_map_ptr),
+    query::getAllPedestrianLineMarkings(index));
+  EXPECT_EQ(query::getAllParkingSpaces(sample_map_ptr), query::getAllParkingSpaces(index));
+  EXPECT_EQ(query::getAllWaypoints(sample_map_ptr), query::getAllWaypoints(index));
+  EXPECT_EQ(
+    query::getAllPolygonsByType(sample_map_ptr, "intersection_area"),
+    query::getAllPolygonsByType(index, "intersection_area"));
+}
+
+TEST_F(PrimitiveTypeIndexTest, InvalidWaypointsAreSkipped)  // NOLINT for gtest
+{
+  namespace query = lanelet::utils::query;
+  const LineString3d left(getId(), {Point3d(getId(), 2., 0., 0.), Point3d(getId(), 2., 1., 0.)});
+  const LineString3d right(getId(), {Point3d(getId(), 3., 0., 0.), Point3d(getId(), 3., 1., 0.)});
+  Lanelet dangling_waypoints(getId(), left, right);
+  dangling_waypoints.attributes()["waypoints"] = getId();
+  sample_map_ptr->add(dangling_waypoints);
+
+  const lanelet::utils::PrimitiveTypeIndex index(sample_map_ptr);
+  EXPECT_EQ(1U, query::getAllWaypoints(index).size());
+  EXPECT_THROW(query::getAllWaypoints(sample_map_ptr), lanelet::NoSuchPrimitiveError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
@@ -14,13 +14,22 @@
 
 // NOLINTBEGIN(readability-identifier-naming)
 
+#include "../benchmark/synthetic_map.hpp"
 #include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+#include "autoware_lanelet2_extension/traffic_rules/autoware_traffic_rules.hpp"
+#include "autoware_lanelet2_extension/utility/lanelet_geometry_cache.hpp"
 #include "autoware_lanelet2_extension/utility/query.hpp"
 
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <cmath>
+#include <cstddef>
+#include <memory>
+#include <unordered_set>
+#include <vector>
 
 using lanelet::Lanelet;
 using lanelet::LineString3d;
@@ -128,6 +137,41 @@ TEST_F(TestSuite, QueryTrafficLights)  // NOLINT for gtest
   ASSERT_EQ(1U, autoware_traffic_lights.size()) << "failed to retrieve autoware traffic lights";
 }
 
+TEST_F(TestSuite, QueryRegulatoryElementsOfType)  // NOLINT for gtest
+{
+  const auto road_lanelet =
+    lanelet::utils::query::roadLanelets(lanelet::utils::query::laneletLayer(sample_map_ptr))
+      .front();
+  const auto traffic_light =
+    road_lanelet.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>().front();
+
+  // a second lanelet sharing the traffic light and referencing another one
+  Lanelet next_lanelet(
+    getId(), LineString3d(getId(), {Point3d(getId(), 0., 1., 0.), Point3d(getId(), 0., 2., 0.)}),
+    LineString3d(getId(), {Point3d(getId(), 1., 1., 0.), Point3d(getId(), 1., 2., 0.)}));
+  const LineString3d base(
+    getId(), Points3d{Point3d(getId(), 0., 2., 4.), Point3d(getId(), 1., 2., 4.)});
+  const LineString3d stop_line(
+    getId(), Points3d{Point3d(getId(), 0., 1., 0.), Point3d(getId(), 1., 1., 0.)});
+  const auto other_traffic_light = lanelet::autoware::AutowareTrafficLight::make(
+    getId(), lanelet::AttributeMap(), {base}, stop_line, {});
+  next_lanelet.addRegulatoryElement(other_traffic_light);
+  next_lanelet.addRegulatoryElement(
+    std::const_pointer_cast<lanelet::autoware::AutowareTrafficLight>(traffic_light));
+
+  const lanelet::ConstLanelets lanelets{road_lanelet, next_lanelet, road_lanelet};
+  const auto found =
+    lanelet::utils::query::regulatoryElementsOfType<lanelet::autoware::AutowareTrafficLight>(
+      lanelets);
+  ASSERT_EQ(2U, found.size()) << "regulatory elements must be unique";
+  EXPECT_EQ(traffic_light->id(), found[0]->id());
+  EXPECT_EQ(other_traffic_light->id(), found[1]->id());
+
+  const auto crosswalks =
+    lanelet::utils::query::regulatoryElementsOfType<lanelet::autoware::Crosswalk>(lanelets);
+  EXPECT_TRUE(crosswalks.empty());
+}
+
 TEST_F(TestSuite, QueryStopLine)  // NOLINT for gtest
 {
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(sample_map_ptr);
@@ -140,6 +184,254 @@ TEST_F(TestSuite, QueryStopLine)  // NOLINT for gtest
   ASSERT_EQ(1U, stop_lines2.size()) << "failed to retrieve stop lines from a lanelet";
 }
 
+TEST_F(TestSuite, QueryCurrentLaneletsOnMap)  // NOLINT for gtest
+{
+  geometry_msgs::msg::Point search_point;
+  search_point.x = 0.5;
+  search_point.y = 0.5;
+
+  lanelet::ConstLanelets current_lanelets;
+  ASSERT_TRUE(
+    lanelet::utils::query::getCurrentLanelets(sample_map_ptr, search_point, &current_lanelets));
+  ASSERT_EQ(2U, current_lanelets.size()) << "failed to retrieve overlapping lanelets";
+  EXPECT_LT(current_lanelets.front().id(), current_lanelets.back().id());
+
+  geometry_msgs::msg::Pose search_pose;
+  search_pose.position = search_point;
+  lanelet::ConstLanelets pose_lanelets;
+  ASSERT_TRUE(
+    lanelet::utils::query::getCurrentLanelets(sample_map_ptr, search_pose, &pose_lanelets));
+  EXPECT_EQ(current_lanelets, pose_lanelets);
+
+  search_point.x = 5.0;
+  lanelet::ConstLanelets outside_lanelets;
+  EXPECT_FALSE(
+    lanelet::utils::query::getCurrentLanelets(sample_map_ptr, search_point, &outside_lanelets));
+  EXPECT_TRUE(outside_lanelets.empty());
+}
+
+TEST_F(TestSuite, QueryLaneletsWithinRangeOnMap)  // NOLINT for gtest
+{
+  // both sample lanelets end 1m before the search point
+  geometry_msgs::msg::Point search_point;
+  search_point.x = 0.5;
+  search_point.y = 2.0;
+
+  EXPECT_TRUE(
+    lanelet::utils::query::getLaneletsWithinRange(sample_map_ptr, search_point, 0.5).empty());
+
+  const auto near_lanelets =
+    lanelet::utils::query::getLaneletsWithinRange(sample_map_ptr, search_point, 1.0);
+  ASSERT_EQ(2U, near_lanelets.size()) << "failed to retrieve lanelets within range";
+  EXPECT_LT(near_lanelets.front().id(), near_lanelets.back().id());
+
+  EXPECT_EQ(
+    near_lanelets, lanelet::utils::query::getLaneletsWithinRange(
+                     sample_map_ptr, lanelet::BasicPoint2d(0.5, 2.0), 1.0));
+}
+
+TEST_F(TestSuite, QueryClosestLaneletOnMap)  // NOLINT for gtest
+{
+  geometry_msgs::msg::Pose search_pose;
+  search_pose.position.x = 3.0;
+  search_pose.position.y = 0.5;
+  search_pose.orientation.w = 1.0;
+
+  // road and crosswalk lanelet have the same shape, the tie is broken by the smaller id
+  lanelet::ConstLanelet closest_lanelet;
+  ASSERT_TRUE(
+    lanelet::utils::query::getClosestLanelet(sample_map_ptr, search_pose, &closest_lanelet));
+  const auto road_lanelets =
+    lanelet::utils::query::roadLanelets(lanelet::utils::query::laneletLayer(sample_map_ptr));
+  ASSERT_EQ(1U, road_lanelets.size());
+  EXPECT_EQ(road_lanelets.front().id(), closest_lanelet.id());
+
+  // a lanelet in between is closer than both
+  Point3d p1(getId(), 1.5, 0., 0.);
+  Point3d p2(getId(), 1.5, 1., 0.);
+  Point3d p3(getId(), 2.5, 0., 0.);
+  Point3d p4(getId(), 2.5, 1., 0.);
+  Lanelet near_lanelet(getId(), LineString3d(getId(), {p1, p2}), LineString3d(getId(), {p3, p4}));
+  sample_map_ptr->add(near_lanelet);
+  ASSERT_TRUE(
+    lanelet::utils::query::getClosestLanelet(sample_map_ptr, search_pose, &closest_lanelet));
+  EXPECT_EQ(near_lanelet.id(), closest_lanelet.id());
+
+  const auto empty_map = std::make_shared<lanelet::LaneletMap>();
+  EXPECT_FALSE(lanelet::utils::query::getClosestLanelet(empty_map, search_pose, &closest_lanelet));
+}
+
+TEST_F(TestSuite, QueryLaneletsOfTrajectory)  // NOLINT for gtest
+{
+  std::vector<geometry_msgs::msg::Pose> trajectory;
+  for (int i = 0; i < 40; ++i) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = -0.5 + 0.05 * i;
+    pose.position.y = 0.5;
+    pose.orientation.w = 1.0;
+    trajectory.push_back(pose);
+  }
+
+  for (const std::size_t max_threads : {1U, 0U}) {
+    const auto current_lanelets =
+      lanelet::utils::query::getCurrentLanelets(sample_map_ptr, trajectory, max_threads);
+    const auto closest_lanelets =
+      lanelet::utils::query::getClosestLanelets(sample_map_ptr, trajectory, max_threads);
+    ASSERT_EQ(trajectory.size(), current_lanelets.size());
+    ASSERT_EQ(trajectory.size(), closest_lanelets.size());
+
+    for (std::size_t i = 0; i < trajectory.size(); ++i) {
+      lanelet::ConstLanelets expected_current;
+      lanelet::utils::query::getCurrentLanelets(sample_map_ptr, trajectory[i], &expected_current);
+      EXPECT_EQ(expected_current, current_lanelets[i]) << "at trajectory point " << i;
+
+      lanelet::ConstLanelet expected_closest;
+      ASSERT_TRUE(
+        lanelet::utils::query::getClosestLanelet(sample_map_ptr, trajectory[i], &expected_closest));
+      ASSERT_TRUE(closest_lanelets[i]);
+      EXPECT_EQ(expected_closest, *closest_lanelets[i]) << "at trajectory point " << i;
+    }
+  }
+
+  const auto empty_map = std::make_shared<lanelet::LaneletMap>();
+  const auto none = lanelet::utils::query::getClosestLanelets(empty_map, trajectory);
+  ASSERT_EQ(trajectory.size(), none.size());
+  EXPECT_FALSE(none.front());
+}
+
+TEST(QueryLaneletSequences, EnumerateSequencesOfJunctionGrid)  // NOLINT for gtest
+{
+  // three lanes of four 20m long segments, every lanelet but those of the left lane is followed by
+  // a lanelet leading into the lane on its left
+  const auto map = lanelet::utils::synthetic::makeSyntheticJunctionGrid(3, 4);
+  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::autoware::DefaultLocation, lanelet::Participants::Vehicle);
+  const lanelet::routing::RoutingGraphPtr graph =
+    lanelet::routing::RoutingGraph::build(*map, *traffic_rules);
+  const auto is_straight = [](const lanelet::ConstLanelet & llt) {
+    return llt.rightBound().front().y() == llt.rightBound().back().y();
+  };
+  lanelet::ConstLanelet first;
+  lanelet::ConstLanelet last;
+  for (const auto & llt : map->laneletLayer) {
+    if (is_straight(llt) && llt.rightBound().front().x() == 0.0 &&
+        llt.rightBound().front().y() == 0.0) {
+      first = llt;
+    }
+    if (is_straight(llt) && llt.rightBound().back().x() == 80.0 &&
+        llt.rightBound().back().y() == 7.0) {
+      last = llt;
+    }
+  }
+
+  // three segments with at most two lane changes
+  const auto succeeding =
+    lanelet::utils::query::enumerateSucceedingLaneletSequences(graph, first, 50.0);
+  ASSERT_EQ(7U, succeeding.size());
+  EXPECT_FALSE(succeeding.truncated);
+  EXPECT_EQ(3U * 7U, succeeding.lanelets.size());
+  const auto sequences = succeeding.toVectors();
+  for (const auto & sequence : sequences) {
+    ASSERT_EQ(3U, sequence.size());
+    EXPECT_TRUE(lanelet::utils::contains(graph->following(first), sequence.front()));
+    for (std::size_t i = 1; i < sequence.size(); ++i) {
+      EXPECT_TRUE(lanelet::utils::contains(graph->following(sequence[i - 1]), sequence[i]));
+    }
+  }
+  for (std::size_t i = 1; i < sequences.size(); ++i) {
+    EXPECT_NE(sequences[i - 1], sequences[i]);
+  }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  EXPECT_EQ(lanelet::utils::query::getSucceedingLaneletSequences(graph, first, 50.0), sequences);
+#pragma GCC diagnostic pop
+
+  const auto capped =
+    lanelet::utils::query::enumerateSucceedingLaneletSequences(graph, first, 50.0, 3);
+  ASSERT_EQ(3U, capped.size());
+  EXPECT_TRUE(capped.truncated);
+  for (std::size_t i = 0; i < capped.size(); ++i) {
+    EXPECT_EQ(succeeding.sequence(i), capped.sequence(i));
+  }
+
+  // two segments, the left lane is reached from the straight and the merging lanelet
+  const auto preceding =
+    lanelet::utils::query::enumeratePrecedingLaneletSequences(graph, last, 30.0);
+  ASSERT_EQ(4U, preceding.size());
+  // no exclusions but a cap
+  const auto first_preceding =
+    lanelet::utils::query::enumeratePrecedingLaneletSequences(graph, last, 30.0, {}, 1);
+  ASSERT_EQ(1U, first_preceding.size());
+  EXPECT_EQ(preceding.sequence(0), first_preceding.sequence(0));
+  for (std::size_t i = 0; i < preceding.size(); ++i) {
+    const auto sequence = preceding.sequence(i);
+    ASSERT_EQ(2U, sequence.size());
+    EXPECT_TRUE(lanelet::utils::contains(graph->previous(last), sequence.back()));
+    EXPECT_TRUE(lanelet::utils::contains(graph->previous(sequence.back()), sequence.front()));
+  }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  EXPECT_EQ(
+    lanelet::utils::query::getPrecedingLaneletSequences(graph, last, 30.0), preceding.toVectors());
+#pragma GCC diagnostic pop
+
+  lanelet::ConstLanelets exclude_lanelets;
+  for (const auto & prev_lanelet : graph->previous(last)) {
+    if (is_straight(prev_lanelet)) {
+      exclude_lanelets.push_back(prev_lanelet);
+    }
+  }
+  ASSERT_EQ(1U, exclude_lanelets.size());
+  const auto excluded = lanelet::utils::query::enumeratePrecedingLaneletSequences(
+    graph, last, 30.0, exclude_lanelets);
+  ASSERT_EQ(2U, excluded.size());
+  EXPECT_FALSE(lanelet::utils::contains(excluded.lanelets, exclude_lanelets.front()));
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  EXPECT_EQ(
+    lanelet::utils::query::getPrecedingLaneletSequences(graph, last, 30.0, exclude_lanelets),
+    excluded.toVectors());
+#pragma GCC diagnostic pop
+  const auto excluded_by_id =
+    lanelet::utils::query::enumeratePrecedingLaneletSequencesExcludingIds(
+      graph, last, 30.0, {exclude_lanelets.front().id()});
+  EXPECT_EQ(excluded.offsets, excluded_by_id.offsets);
+  EXPECT_EQ(excluded.lanelets, excluded_by_id.lanelets);
+
+  // staying in the rightmost lane, the first step is straight and two lane changes are left
+  std::unordered_set<lanelet::Id> exclude_ids;
+  for (const auto & next_lanelet : graph->following(first)) {
+    if (!is_straight(next_lanelet)) {
+      exclude_ids.insert(next_lanelet.id());
+    }
+  }
+  ASSERT_EQ(1U, exclude_ids.size());
+  const auto lookahead = lanelet::utils::query::enumerateSucceedingLaneletSequencesExcludingIds(
+    graph, first, 50.0, exclude_ids);
+  EXPECT_EQ(4U, lookahead.size());
+  for (const auto & llt : lookahead.lanelets) {
+    EXPECT_EQ(0U, exclude_ids.count(llt.id()));
+  }
+  for (const auto & next_lanelet : graph->following(first)) {
+    exclude_ids.insert(next_lanelet.id());
+  }
+  const auto blocked = lanelet::utils::query::enumerateSucceedingLaneletSequencesExcludingIds(
+    graph, first, 50.0, exclude_ids);
+  EXPECT_TRUE(blocked.empty());
+  // the cached lengths equal the computed ones, so the sequences do too
+  const lanelet::utils::LaneletGeometryCache geometry_cache(map);
+  const auto cached = lanelet::utils::query::enumerateSucceedingLaneletSequencesExcludingIds(
+    graph, first, 50.0, {}, geometry_cache);
+  EXPECT_EQ(succeeding.offsets, cached.offsets);
+  EXPECT_EQ(succeeding.lanelets, cached.lanelets);
+  const auto cached_preceding =
+    lanelet::utils::query::enumeratePrecedingLaneletSequencesExcludingIds(
+      graph, last, 30.0, {}, geometry_cache, 1);
+  ASSERT_EQ(1U, cached_preceding.size());
+  EXPECT_TRUE(cached_preceding.truncated);
+  EXPECT_EQ(preceding.sequence(0), cached_preceding.sequence(0));
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,132 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/regulatory_element_index.hpp"
+
+#include "autoware_lanelet2_extension/utility/query.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <vector>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::Points3d;
+using lanelet::utils::getId;
+
+class RegulatoryElementIndexTest : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  RegulatoryElementIndexTest() : sample_map_ptr(new lanelet::LaneletMap())
+  {
+    // three consecutive lanelets along the y axis, the first two share a traffic light and the
+    // second one has a speed bump
+    for (int i = 0; i < 3; ++i) {
+      const LineString3d left(
+        getId(), {Point3d(getId(), 0., i, 0.), Point3d(getId(), 0., i + 1., 0.)});
+      const LineString3d right(
+        getId(), {Point3d(getId(), 1., i, 0.), Point3d(getId(), 1., i + 1., 0.)});
+      lanelets.push_back(Lanelet(getId(), left, right));
+    }
+
+    const LineString3d traffic_light_base(
+      getId(), Points3d{Point3d(getId(), 0., 2., 4.), Point3d(getId(), 1., 2., 4.)});
+    const LineString3d stop_line(
+      getId(), Points3d{Point3d(getId(), 0., 2., 0.), Point3d(getId(), 1., 2., 0.)});
+    traffic_light = lanelet::autoware::AutowareTrafficLight::make(
+      getId(), lanelet::AttributeMap(), {traffic_light_base}, stop_line, {});
+    lanelets[0].addRegulatoryElement(traffic_light);
+    lanelets[1].addRegulatoryElement(traffic_light);
+
+    const lanelet::Polygon3d speed_bump_polygon(
+      getId(), {Point3d(getId(), 0., 1.4, 0.), Point3d(getId(), 1., 1.4, 0.),
+                Point3d(getId(), 1., 1.6, 0.), Point3d(getId(), 0., 1.6, 0.)});
+    speed_bump =
+      lanelet::autoware::SpeedBump::make(getId(), lanelet::AttributeMap(), speed_bump_polygon);
+    lanelets[1].addRegulatoryElement(speed_bump);
+
+    for (const auto & llt : lanelets) {
+      sample_map_ptr->add(llt);
+    }
+  }
+
+  ~RegulatoryElementIndexTest() override = default;
+
+  lanelet::LaneletMapPtr sample_map_ptr;
+  std::vector<Lanelet> lanelets;
+  lanelet::autoware::AutowareTrafficLight::Ptr traffic_light;
+  lanelet::autoware::SpeedBump::Ptr speed_bump;
+};
+
+TEST_F(RegulatoryElementIndexTest, EmptyIndex)  // NOLINT for gtest
+{
+  const lanelet::utils::RegulatoryElementIndex index;
+  EXPECT_EQ(0U, index.size());
+  EXPECT_TRUE(index.regulatoryElementsAs<lanelet::TrafficLight>(lanelets[0]).empty());
+}
+
+TEST_F(RegulatoryElementIndexTest, RegulatoryElementsOfLanelet)  // NOLINT for gtest
+{
+  const lanelet::utils::RegulatoryElementIndex index(sample_map_ptr);
+  EXPECT_EQ(2U, index.size());
+
+  for (const auto & llt : lanelets) {
+    const lanelet::ConstLanelet const_llt = llt;
+    EXPECT_EQ(
+      const_llt.regulatoryElementsAs<lanelet::TrafficLight>(),
+      index.regulatoryElementsAs<lanelet::TrafficLight>(const_llt));
+    EXPECT_EQ(
+      const_llt.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>(),
+      index.regulatoryElementsAs<lanelet::autoware::AutowareTrafficLight>(const_llt));
+    EXPECT_EQ(
+      const_llt.regulatoryElementsAs<lanelet::autoware::SpeedBump>(),
+      index.regulatoryElementsAs<lanelet::autoware::SpeedBump>(const_llt));
+    EXPECT_TRUE(index.regulatoryElementsAs<lanelet::autoware::Crosswalk>(const_llt).empty());
+  }
+
+  // the index is a snapshot of the map
+  lanelets[2].addRegulatoryElement(speed_bump);
+  EXPECT_TRUE(index.regulatoryElementsAs<lanelet::autoware::SpeedBump>(lanelets[2]).empty());
+}
+
+TEST_F(RegulatoryElementIndexTest, QueryOverloads)  // NOLINT for gtest
+{
+  const lanelet::utils::RegulatoryElementIndex index(sample_map_ptr);
+  const lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(sample_map_ptr);
+
+  EXPECT_EQ(
+    lanelet::utils::query::trafficLights(all_lanelets),
+    lanelet::utils::query::trafficLights(index, all_lanelets));
+  const auto autoware_traffic_lights =
+    lanelet::utils::query::autowareTrafficLights(index, all_lanelets);
+  ASSERT_EQ(1U, autoware_traffic_lights.size());
+  EXPECT_EQ(traffic_light->id(), autoware_traffic_lights.front()->id());
+  const auto speed_bumps = lanelet::utils::query::speedBumps(index, all_lanelets);
+  ASSERT_EQ(1U, speed_bumps.size());
+  EXPECT_EQ(speed_bump->id(), speed_bumps.front()->id());
+  EXPECT_TRUE(lanelet::utils::query::crosswalks(index, all_lanelets).empty());
+  EXPECT_TRUE(lanelet::utils::query::speedBumps(index, {lanelets[0], lanelets[2]}).empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,143 @@
+// Copyright 2026 Autoware Foundation. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+#include "autoware_lanelet2_extension/utility/traffic_light_index.hpp"
+
+#include "autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <algorithm>
+
+using lanelet::Lanelet;
+using lanelet::LineString3d;
+using lanelet::Point3d;
+using lanelet::Points3d;
+using lanelet::utils::getId;
+
+class TrafficLightIndexTest : public ::testing::Test  // NOLINT for gtest
+{
+public:
+  TrafficLightIndexTest() : sample_map_ptr(new lanelet::LaneletMap())
+  {
+    // two parallel lanelets controlled by one traffic light with a stop line
+    const LineString3d left(getId(), {Point3d(getId(), 0., 0., 0.), Point3d(getId(), 0., 1., 0.)});
+    const LineString3d middle(
+      getId(), {Point3d(getId(), 1., 0., 0.), Point3d(getId(), 1., 1., 0.)});
+    const LineString3d right(getId(), {Point3d(getId(), 2., 0., 0.), Point3d(getId(), 2., 1., 0.)});
+    Lanelet left_lanelet(getId(), left, middle);
+    Lanelet right_lanelet(getId(), middle, right);
+
+    traffic_light_base =
+      LineString3d(getId(), Points3d{Point3d(getId(), 0., 1., 4.), Point3d(getId(), 2., 1., 4.)});
+    light_bulbs = LineString3d(
+      getId(), Points3d{Point3d(getId(), 0.5, 1., 4.5), Point3d(getId(), 1.5, 1., 4.5)});
+    light_bulbs.attributes()["traffic_light_id"] = traffic_light_base.id();
+    untagged_light_bulbs = LineString3d(getId(), Points3d{Point3d(getId(), 1., 1., 4.5)});
+    stop_line =
+      LineString3d(getId(), Points3d{Point3d(getId(), 0., 1., 0.), Point3d(getId(), 2., 1., 0.)});
+
+    traffic_light = lanelet::autoware::AutowareTrafficLight::make(
+      getId(), lanelet::AttributeMap(), {traffic_light_base}, stop_line,
+      {light_bulbs, untagged_light_bulbs});
+    left_lanelet.addRegulatoryElement(traffic_light);
+    right_lanelet.addRegulatoryElement(traffic_light);
+
+    // a second traffic light without stop line sharing the same signal
+    other_traffic_light = lanelet::autoware::AutowareTrafficLight::make(
+      getId(), lanelet::AttributeMap(), {traffic_light_base}, {}, {light_bulbs});
+
+    sample_map_ptr->add(left_lanelet);
+    sample_map_ptr->add(right_lanelet);
+    sample_map_ptr->add(other_traffic_light);
+    controlled_lanelets = {left_lanelet, right_lanelet};
+  }
+
+  ~TrafficLightIndexTest() override = default;
+
+  lanelet::LaneletMapPtr sample_map_ptr;
+  LineString3d traffic_light_base;
+  LineString3d light_bulbs;
+  LineString3d untagged_light_bulbs;
+  LineString3d stop_line;
+  lanelet::autoware::AutowareTrafficLight::Ptr traffic_light;
+  lanelet::autoware::AutowareTrafficLight::Ptr other_traffic_light;
+  lanelet::ConstLanelets controlled_lanelets;
+};
+
+TEST_F(TrafficLightIndexTest, EmptyIndex)  // NOLINT for gtest
+{
+  const lanelet::utils::TrafficLightIndex index;
+  EXPECT_EQ(0U, index.size());
+  EXPECT_FALSE(index.regulatoryElement(traffic_light->id()));
+  EXPECT_TRUE(index.lightBulbs(traffic_light_base.id()).empty());
+  EXPECT_FALSE(index.stopLine(traffic_light->id()));
+}
+
+TEST_F(TrafficLightIndexTest, RegulatoryElements)  // NOLINT for gtest
+{
+  const lanelet::utils::TrafficLightIndex index(sample_map_ptr);
+  EXPECT_EQ(2U, index.size());
+
+  ASSERT_TRUE(index.regulatoryElement(traffic_light->id()));
+  EXPECT_EQ(traffic_light->id(), index.regulatoryElement(traffic_light->id())->id());
+  EXPECT_FALSE(index.regulatoryElement(traffic_light_base.id()));
+
+  EXPECT_EQ(2U, index.regulatoryElementsOfTrafficLight(traffic_light_base.id()).size());
+  EXPECT_EQ(2U, index.regulatoryElementsOfLightBulbs(light_bulbs.id()).size());
+  const auto & untagged = index.regulatoryElementsOfLightBulbs(untagged_light_bulbs.id());
+  ASSERT_EQ(1U, untagged.size());
+  EXPECT_EQ(traffic_light->id(), untagged.front()->id());
+}
+
+TEST_F(TrafficLightIndexTest, LightBulbs)  // NOLINT for gtest
+{
+  const lanelet::utils::TrafficLightIndex index(sample_map_ptr);
+
+  // light bulbs shared by both regulatory elements are listed once
+  const auto & bulbs = index.lightBulbs(traffic_light_base.id());
+  ASSERT_EQ(1U, bulbs.size());
+  EXPECT_EQ(light_bulbs.id(), bulbs.front().id());
+
+  ASSERT_TRUE(index.trafficLightIdOfLightBulbs(light_bulbs.id()));
+  EXPECT_EQ(traffic_light_base.id(), *index.trafficLightIdOfLightBulbs(light_bulbs.id()));
+  EXPECT_FALSE(index.trafficLightIdOfLightBulbs(untagged_light_bulbs.id()));
+}
+
+TEST_F(TrafficLightIndexTest, StopLineAndLanelets)  // NOLINT for gtest
+{
+  const lanelet::utils::TrafficLightIndex index(sample_map_ptr);
+
+  ASSERT_TRUE(index.stopLine(traffic_light->id()));
+  EXPECT_EQ(stop_line.id(), index.stopLine(traffic_light->id())->id());
+  EXPECT_FALSE(index.stopLine(other_traffic_light->id()));
+
+  const auto & lanelets = index.controlledLanelets(traffic_light->id());
+  ASSERT_EQ(2U, lanelets.size());
+  for (const auto & llt : controlled_lanelets) {
+    EXPECT_NE(lanelets.end(), std::find(lanelets.begin(), lanelets.end(), llt));
+  }
+  EXPECT_TRUE(index.controlledLanelets(other_traffic_light->id()).empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// NOLINTEND(readability-identifier-naming)
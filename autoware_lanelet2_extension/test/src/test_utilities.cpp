@@ -16,11 +16,17 @@
 
 #include "autoware_lanelet2_extension/utility/utilities.hpp"
 
+#include "../benchmark/synthetic_map.hpp"
+
 #include <gtest/gtest.h>
+#include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/primitives/Point.h>
 #include <lanelet2_routing/RoutingGraphContainer.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <map>
 #include <unordered_map>
 
@@ -159,6 +165,74 @@ TEST_F(TestSuite, OverwriteLaneletsCenterline)  // NOLINT for gtest
   }
 }
 
+TEST(Utilities, OverwriteLaneletsCenterlineInParallel)  // NOLINT for gtest
+{
+  lanelet::utils::synthetic::SyntheticMapConfig config;
+  config.lanelets = 400;
+  config.polygons = 0;
+  const auto map = lanelet::utils::synthetic::makeSyntheticMap(config);
+
+  const auto centerline_ids = [&map]() {
+    std::map<lanelet::Id, lanelet::Id> ids;
+    lanelet::Id first_id = std::numeric_limits<lanelet::Id>::max();
+    for (const auto & llt : map->laneletLayer) {
+      const auto centerline = llt.centerline();
+      for (std::size_t i = 0; i < centerline.size(); ++i) {
+        EXPECT_EQ(centerline.id() + 1 + static_cast<lanelet::Id>(i), centerline[i].id());
+      }
+      ids[llt.id()] = centerline.id();
+      first_id = std::min(first_id, centerline.id());
+    }
+    // relative to the first id, which depends on the ids taken before
+    for (auto & id : ids) {
+      id.second -= first_id;
+    }
+    return ids;
+  };
+
+  lanelet::utils::CenterlineOverwriteStats stats;
+  lanelet::utils::overwriteLaneletsCenterline(map, 5.0, false, 1, &stats);
+  EXPECT_EQ(400U, stats.lanelets);
+  EXPECT_GE(stats.elapsed_ms, 0.0);
+  std::size_t points = 0;
+  for (const auto & llt : map->laneletLayer) {
+    points += llt.centerline().size();
+  }
+  EXPECT_EQ(points, stats.points);
+  const auto serial_ids = centerline_ids();
+
+  // the centerlines are custom now and are only replaced when forced
+  lanelet::utils::overwriteLaneletsCenterline(map, 5.0, false, 4, &stats);
+  EXPECT_EQ(0U, stats.lanelets);
+  lanelet::utils::overwriteLaneletsCenterline(map, 5.0, true, 4, &stats);
+  EXPECT_EQ(400U, stats.lanelets);
+  EXPECT_EQ(serial_ids, centerline_ids());
+}
+
+TEST_F(TestSuite, WarmUpMap)  // NOLINT for gtest
+{
+  const auto stats = lanelet::utils::warmUpMap(sample_map_ptr, 2);
+  EXPECT_EQ(4U, stats.lanelets);
+  EXPECT_GE(stats.centerline_ms, 0.0);
+  EXPECT_EQ(0.0, stats.geometry_cache_ms);
+  // the custom centerline is kept
+  EXPECT_EQ(3U, sample_map_ptr->laneletLayer.get(road_lanelet.id()).centerline().size());
+
+  lanelet::utils::LaneletGeometryCache geometry_cache;
+  const auto stats_with_cache = lanelet::utils::warmUpMap(sample_map_ptr, 2, &geometry_cache);
+  EXPECT_EQ(4U, stats_with_cache.lanelets);
+  EXPECT_GE(stats_with_cache.geometry_cache_ms, 0.0);
+  EXPECT_EQ(4U, geometry_cache.size());
+  for (const auto & llt : sample_map_ptr->laneletLayer) {
+    EXPECT_DOUBLE_EQ(lanelet::geometry::length3d(llt), geometry_cache.length3d(llt));
+    const auto * geometry = geometry_cache.find(llt);
+    ASSERT_NE(nullptr, geometry);
+    EXPECT_EQ(llt.polygon2d().basicPolygon(), geometry->polygon);
+  }
+
+  EXPECT_EQ(0U, lanelet::utils::warmUpMap(nullptr).lanelets);
+}
+
 /*
 TEST(Utilities, copyZ)  // NOLINT for gtest
 {